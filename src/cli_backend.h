@@ -0,0 +1,329 @@
+/*******************************************************************************************
+*
+*   rGuiIcons - Command-line only backend
+*
+*   Minimal backend for RAYGUI_STANDALONE mode, used by the command-line only build
+*   (RGUIICONS_CLI_ONLY): no window, no graphics device, no input devices, only libc
+*
+*   NOTES:
+*     - Input functions report no input, drawing functions do nothing
+*     - File access functions implemented using standard C file I/O
+*     - Data decompression implemented with sinflate() provided by rpng
+*     - Must be included before raygui implementation (RAYGUI_IMPLEMENTATION)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019-2024 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef CLI_BACKEND_H
+#define CLI_BACKEND_H
+
+#include "raygui.h"             // Required for: raygui types (Vector2, Rectangle, Color, Font...)
+
+#include <stdlib.h>             // Required for: calloc(), realloc(), free()
+#include <stdio.h>              // Required for: FILE, fopen(), fread(), fwrite(), fclose()
+#include <string.h>             // Required for: strrchr(), strlen(), strncpy()
+#include <ctype.h>              // Required for: tolower()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RL_CALLOC
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+#endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(ptr,sz)  realloc(ptr,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(ptr)        free(ptr)
+#endif
+
+#define BLANK               (Color){ 0, 0, 0, 0 }
+
+// Keys and buttons not defined by raygui standalone mode (values from raylib)
+#define KEY_DELETE          261
+#define KEY_HOME            268
+#define KEY_END             269
+#define KEY_KP_ENTER        335
+#define KEY_LEFT_SHIFT      340
+#define KEY_LEFT_CONTROL    341
+#define KEY_RIGHT_CONTROL   345
+#define KEY_V                86
+
+#define MOUSE_MIDDLE_BUTTON   2
+
+#define MAX_DECOMPRESSION_SIZE  64      // Max size allocated for decompression in MB
+#define DECOMPRESSION_MARGIN    65536   // Output space left by a truncated decompression, max DEFLATE stored block size (+1)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// rpng deflate decompression, implemented with RPNG_DEFLATE_IMPLEMENTATION
+extern int sinflate(void *out, int cap, const void *in, int size);
+
+// Additional functions required by raygui, not declared by standalone mode
+static int GetScreenWidth(void);
+static Color Fade(Color color, float alpha);
+static const char *GetClipboardText(void);
+static void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2); // Implemented by raygui
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);
+static void UnloadTexture(Texture2D texture);
+static int GetGlyphIndex(Font font, int codepoint);
+static int GetCodepoint(const char *text, int *codepointSize);
+static int GetCodepointNext(const char *text, int *codepointSize);     // Implemented by raygui
+static int GetCodepointPrevious(const char *text, int *codepointSize);
+
+// Additional functions required by rGuiIcons command-line
+static bool IsFileExtension(const char *fileName, const char *ext);
+static unsigned char *LoadFileData(const char *fileName, int *dataSize);
+static void UnloadFileData(unsigned char *data);
+static bool SaveFileData(const char *fileName, void *data, int dataSize);
+static void MemFree(void *ptr);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: raygui required
+//----------------------------------------------------------------------------------
+// Input: no input devices available
+static Vector2 GetMousePosition(void) { return (Vector2){ 0 }; }
+static float GetMouseWheelMove(void) { return 0.0f; }
+static bool IsMouseButtonDown(int button) { return false; }
+static bool IsMouseButtonPressed(int button) { return false; }
+static bool IsMouseButtonReleased(int button) { return false; }
+static bool IsKeyDown(int key) { return false; }
+static bool IsKeyPressed(int key) { return false; }
+static int GetCharPressed(void) { return 0; }
+static const char *GetClipboardText(void) { return NULL; }
+
+// Drawing: no graphics device available
+static int GetScreenWidth(void) { return 0; }
+static void DrawRectangle(int x, int y, int width, int height, Color color) { }
+static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4) { }
+static void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) { }
+static Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing) { return (Vector2){ 0 }; }
+
+// Text: no font atlas textures available
+static Font GetFontDefault(void) { return (Font){ 0 }; }
+static Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount) { return (Font){ 0 }; }
+static Texture2D LoadTextureFromImage(Image image) { return (Texture2D){ 0 }; }
+static void UnloadTexture(Texture2D texture) { }
+static void SetShapesTexture(Texture2D tex, Rectangle rec) { }
+static int *LoadCodepoints(const char *text, int *count) { *count = 0; return NULL; }
+static void UnloadCodepoints(int *codepoints) { RL_FREE(codepoints); }
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+static Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){ color.r, color.g, color.b, (unsigned char)(255.0f*alpha) };
+}
+
+// Get index position for a unicode character on font
+static int GetGlyphIndex(Font font, int codepoint)
+{
+    int index = 0;
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == codepoint) { index = i; break; }
+    }
+
+    return index;
+}
+
+// Get next codepoint in a UTF-8 encoded text
+static int GetCodepoint(const char *text, int *codepointSize)
+{
+    return GetCodepointNext(text, codepointSize);
+}
+
+// Get previous codepoint in a UTF-8 encoded text
+static int GetCodepointPrevious(const char *text, int *codepointSize)
+{
+    const char *ptr = text;
+    int codepoint = 0x3f;       // Codepoint (defaults to '?')
+    int cpSize = 0;
+    *codepointSize = 0;
+
+    // Move to previous codepoint
+    do ptr--;
+    while (((0x80 & ptr[0]) != 0) && ((0xc0 & ptr[0]) == 0x80));
+
+    codepoint = GetCodepointNext(ptr, &cpSize);
+
+    if (codepoint != 0) *codepointSize = cpSize;
+
+    return codepoint;
+}
+
+// Load text data from file (read), returns a '\0' terminated string
+static char *LoadFileText(const char *fileName)
+{
+    int dataSize = 0;
+    char *text = (char *)LoadFileData(fileName, &dataSize);
+
+    return text;
+}
+
+// Unload file text data allocated by LoadFileText()
+static void UnloadFileText(char *text)
+{
+    RL_FREE(text);
+}
+
+// Get full path for a given fileName with path
+static const char *GetDirectoryPath(const char *filePath)
+{
+    static char dirPath[512] = { 0 };
+    memset(dirPath, 0, 512);
+
+    const char *lastSlash = strrchr(filePath, '/');
+    const char *lastBackSlash = strrchr(filePath, '\\');
+    if ((lastSlash == NULL) || (lastBackSlash > lastSlash)) lastSlash = lastBackSlash;
+
+    if (lastSlash == NULL) dirPath[0] = '.';
+    else if (lastSlash == filePath) dirPath[0] = filePath[0];
+    else
+    {
+        int length = (int)(lastSlash - filePath);
+        strncpy(dirPath, filePath, (length < 511)? length : 511);
+    }
+
+    return dirPath;
+}
+
+// Decompress data (DEFLATE algorithm), memory must be freed with MemFree()
+// NOTE: Output buffer sized from compressed data size, grown geometrically (decompression
+// restarted) while output could be truncated: sinflate() stops once less than one DEFLATE
+// block fits, so output closer than DECOMPRESSION_MARGIN to buffer capacity is not complete
+static unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    unsigned char *data = NULL;
+    int capacity = DECOMPRESSION_MARGIN + ((compDataSize < MAX_DECOMPRESSION_SIZE*1024*1024/8)? compDataSize*4 : MAX_DECOMPRESSION_SIZE*1024*1024 - DECOMPRESSION_MARGIN);
+    int size = 0;
+    *dataSize = 0;
+
+    while (true)
+    {
+        unsigned char *temp = (unsigned char *)RL_REALLOC(data, capacity);
+        if (temp == NULL) { RL_FREE(data); return NULL; }
+        data = temp;
+
+        size = sinflate(data, capacity, compData, compDataSize);
+
+        if ((size <= (capacity - DECOMPRESSION_MARGIN)) || (capacity >= MAX_DECOMPRESSION_SIZE*1024*1024)) break;
+
+        capacity = (capacity <= MAX_DECOMPRESSION_SIZE*1024*1024/2)? capacity*2 : MAX_DECOMPRESSION_SIZE*1024*1024;
+    }
+
+    if (size > 0)
+    {
+        unsigned char *temp = (unsigned char *)RL_REALLOC(data, size);
+        if (temp != NULL) data = temp;
+        *dataSize = size;
+    }
+    else { RL_FREE(data); data = NULL; }
+
+    return data;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: rGuiIcons command-line required
+//----------------------------------------------------------------------------------
+// Check file extension (including point: .png, .rgi), case-insensitive
+static bool IsFileExtension(const char *fileName, const char *ext)
+{
+    bool result = false;
+    const char *fileExt = strrchr(fileName, '.');
+
+    if ((fileExt != NULL) && (strlen(fileExt) == strlen(ext)))
+    {
+        result = true;
+
+        for (int i = 0; fileExt[i] != '\0'; i++)
+        {
+            if (tolower((unsigned char)fileExt[i]) != tolower((unsigned char)ext[i])) { result = false; break; }
+        }
+    }
+
+    return result;
+}
+
+// Load data from file into a buffer, a '\0' is appended after data
+static unsigned char *LoadFileData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int size = (int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)RL_CALLOC(size + 1, 1);
+
+            if (data != NULL)
+            {
+                *dataSize = (int)fread(data, 1, size, file);
+                data[*dataSize] = '\0';
+            }
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Unload file data allocated by LoadFileData()
+static void UnloadFileData(unsigned char *data)
+{
+    RL_FREE(data);
+}
+
+// Save data to file from buffer
+static bool SaveFileData(const char *fileName, void *data, int dataSize)
+{
+    bool success = false;
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        success = ((int)fwrite(data, 1, dataSize, file) == dataSize);
+        fclose(file);
+    }
+
+    return success;
+}
+
+// Free memory allocated by backend/rpng functions
+static void MemFree(void *ptr)
+{
+    RL_FREE(ptr);
+}
+
+#endif // CLI_BACKEND_H
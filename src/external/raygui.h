@@ -140,6 +140,10 @@
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_GLYPHS_CACHE_SIZE 256
+*           Number of codepoints with glyph width cached for direct access (default 256),
+*           cache is built when gui font is set, other codepoints use a glyph search
+*
 *   VERSIONS HISTORY:
 *       5.0-dev (2025)    Current dev version...
 *                         ADDED: guiControlExclusiveMode and guiControlExclusiveRec for exclusive modes
@@ -147,12 +151,14 @@
 *                         ADDED: GuiDropdonwBox() properties: DROPDOWN_ARROW_HIDDEN, DROPDOWN_ROLL_UP
 *                         ADDED: GuiListView() property: LIST_ITEMS_BORDER_WIDTH
 *                         ADDED: GuiLoadIconsFromMemory()
+*                         ADDED: Glyphs width cache for text measuring and drawing
 *                         ADDED: Multiple new icons
 *                         REMOVED: GuiSpinner() from controls list, using BUTTON + VALUEBOX properties
 *                         REMOVED: GuiSliderPro(), functionality was redundant
 *                         REVIEWED: Controls using text labels to use LABEL properties
 *                         REVIEWED: Replaced sprintf() by snprintf() for more safety
 *                         REVIEWED: GuiTabBar(), close tab with mouse middle button
+*                         REVIEWED: GuiLoadStyle(), single file read, binary/text detected by signature
 *                         REVIEWED: GuiScrollPanel(), scroll speed proportional to content
 *                         REVIEWED: GuiDropdownBox(), support roll up and hidden arrow
 *                         REVIEWED: GuiTextBox(), cursor position initialization
@@ -1373,6 +1379,10 @@ static unsigned int *guiIconsPtr = guiIcons;
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
 
+#ifndef RAYGUI_GLYPHS_CACHE_SIZE
+    #define RAYGUI_GLYPHS_CACHE_SIZE    256     // Gui font glyphs width cached, direct access by codepoint [0..size-1]
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -1416,6 +1426,11 @@ static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI
 
 static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
 
+// Gui font glyphs width cache (unscaled), direct-mapped by codepoint
+// NOTE: Avoids GetGlyphIndex() linear search per character, it is rebuilt on font change
+static float guiGlyphsWidth[RAYGUI_GLYPHS_CACHE_SIZE] = { 0 };
+static Font guiGlyphsFont = { 0 };          // Font used to build glyphs width cache
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1495,6 +1510,8 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary only)
 
 static int GetTextWidth(const char *text);                      // Gui get text width using gui font and style
+static float GetGlyphWidth(int codepoint);                      // Gui get glyph width using gui font (unscaled, cached)
+static void LoadGlyphsWidthCache(void);                         // Load glyphs width cache for gui font
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
 
@@ -1557,6 +1574,7 @@ void GuiSetFont(Font font)
         if (!guiStyleLoaded) GuiLoadStyleDefault();
 
         guiFont = font;
+        LoadGlyphsWidthCache();
     }
 }
 
@@ -2807,7 +2825,6 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
             if (CheckCollisionPointRec(mousePosition, textBounds))     // Mouse hover text
             {
                 float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
-                int codepointIndex = 0;
                 float glyphWidth = 0.0f;
                 float widthToMouseX = 0;
                 int mouseCursorIndex = 0;
@@ -2815,10 +2832,7 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
                 for (int i = textIndexOffset; i < textLength; i += codepointSize)
                 {
                     codepoint = GetCodepointNext(&text[i], &codepointSize);
-                    codepointIndex = GetGlyphIndex(guiFont, codepoint);
-
-                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+                    glyphWidth = GetGlyphWidth(codepoint)*scaleFactor;
 
                     if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
                     {
@@ -4249,113 +4263,111 @@ void GuiLoadStyle(const char *fileName)
 {
     #define MAX_LINE_BUFFER_SIZE    256
 
-    bool tryBinary = false;
     if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-    // Try reading the files as text file first
-    FILE *rgsFile = fopen(fileName, "rt");
+    // Load file data at once, style file type is detected by signature:
+    // binary style files start with "rGS ", text style files start with '#'
+    unsigned char *fileData = NULL;
+    int fileDataSize = 0;
+
+    FILE *rgsFile = fopen(fileName, "rb");
 
     if (rgsFile != NULL)
     {
-        char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
-        fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
+        fseek(rgsFile, 0, SEEK_END);
+        fileDataSize = ftell(rgsFile);
+        fseek(rgsFile, 0, SEEK_SET);
 
-        if (buffer[0] == '#')
+        if (fileDataSize > 0)
         {
-            int controlId = 0;
-            int propertyId = 0;
-            unsigned int propertyValue = 0;
-
-            while (!feof(rgsFile))
-            {
-                switch (buffer[0])
-                {
-                    case 'p':
-                    {
-                        // Style property: p <control_id> <property_id> <property_value> <property_name>
-
-                        sscanf(buffer, "p %d %d 0x%x", &controlId, &propertyId, &propertyValue);
-                        GuiSetStyle(controlId, propertyId, (int)propertyValue);
-
-                    } break;
-                    case 'f':
-                    {
-                        // Style font: f <gen_font_size> <charmap_file> <font_file>
-
-                        int fontSize = 0;
-                        char charmapFileName[256] = { 0 };
-                        char fontFileName[256] = { 0 };
-                        sscanf(buffer, "f %d %s %[^\r\n]s", &fontSize, charmapFileName, fontFileName);
-
-                        Font font = { 0 };
-                        int *codepoints = NULL;
-                        int codepointCount = 0;
+            // NOTE: One extra byte allocated for text data null terminator
+            fileData = (unsigned char *)RAYGUI_CALLOC(fileDataSize + 1, sizeof(unsigned char));
+            fileDataSize = (int)fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+        }
 
-                        if (charmapFileName[0] != '0')
-                        {
-                            // Load text data from file
-                            // NOTE: Expected an UTF-8 array of codepoints, no separation
-                            char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
-                            codepoints = LoadCodepoints(textData, &codepointCount);
-                            UnloadFileText(textData);
-                        }
+        fclose(rgsFile);
+    }
 
-                        if (fontFileName[0] != '\0')
-                        {
-                            // In case a font is already loaded and it is not default internal font, unload it
-                            if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
+    if ((fileData != NULL) && (fileDataSize >= 12) && (memcmp(fileData, "rGS ", 4) == 0))
+    {
+        GuiLoadStyleFromMemory(fileData, fileDataSize);
+    }
+    else if ((fileData != NULL) && (fileData[0] == '#'))
+    {
+        // Parse text style data, line by line over loaded data
+        for (char *line = (char *)fileData; line != NULL; )
+        {
+            char *lineEnd = strchr(line, '\n');
 
-                            if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
-                            else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
-                        }
+            switch (line[0])
+            {
+                case 'p':
+                {
+                    // Style property: p <control_id> <property_id> <property_value> <property_name>
+                    // NOTE: Property value is provided in hexadecimal (0x prefixed)
+                    char *linePtr = line + 1;
+                    int controlId = (int)strtol(linePtr, &linePtr, 10);
+                    int propertyId = (int)strtol(linePtr, &linePtr, 10);
+                    unsigned int propertyValue = (unsigned int)strtoul(linePtr, &linePtr, 16);
 
-                        // If font texture not properly loaded, revert to default font and size/spacing
-                        if (font.texture.id == 0)
-                        {
-                            font = GetFontDefault();
-                            GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
-                            GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
-                        }
+                    GuiSetStyle(controlId, propertyId, (int)propertyValue);
 
-                        UnloadCodepoints(codepoints);
+                } break;
+                case 'f':
+                {
+                    // Style font: f <gen_font_size> <charmap_file> <font_file>
+                    char buffer[MAX_LINE_BUFFER_SIZE] = { 0 };
+                    int lineSize = (lineEnd != NULL)? (int)(lineEnd - line) : (int)strlen(line);
+                    memcpy(buffer, line, (lineSize < (MAX_LINE_BUFFER_SIZE - 1))? lineSize : (MAX_LINE_BUFFER_SIZE - 1));
 
-                        if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
+                    int fontSize = 0;
+                    char charmapFileName[256] = { 0 };
+                    char fontFileName[256] = { 0 };
+                    sscanf(buffer, "f %d %s %[^\r\n]s", &fontSize, charmapFileName, fontFileName);
 
-                    } break;
-                    default: break;
-                }
+                    Font font = { 0 };
+                    int *codepoints = NULL;
+                    int codepointCount = 0;
 
-                fgets(buffer, MAX_LINE_BUFFER_SIZE, rgsFile);
-            }
-        }
-        else tryBinary = true;
+                    if (charmapFileName[0] != '0')
+                    {
+                        // Load text data from file
+                        // NOTE: Expected an UTF-8 array of codepoints, no separation
+                        char *textData = LoadFileText(TextFormat("%s/%s", GetDirectoryPath(fileName), charmapFileName));
+                        codepoints = LoadCodepoints(textData, &codepointCount);
+                        UnloadFileText(textData);
+                    }
 
-        fclose(rgsFile);
-    }
+                    if (fontFileName[0] != '\0')
+                    {
+                        // In case a font is already loaded and it is not default internal font, unload it
+                        if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
 
-    if (tryBinary)
-    {
-        rgsFile = fopen(fileName, "rb");
+                        if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
+                        else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
+                    }
 
-        if (rgsFile != NULL)
-        {
-            fseek(rgsFile, 0, SEEK_END);
-            int fileDataSize = ftell(rgsFile);
-            fseek(rgsFile, 0, SEEK_SET);
+                    // If font texture not properly loaded, revert to default font and size/spacing
+                    if (font.texture.id == 0)
+                    {
+                        font = GetFontDefault();
+                        GuiSetStyle(DEFAULT, TEXT_SIZE, 10);
+                        GuiSetStyle(DEFAULT, TEXT_SPACING, 1);
+                    }
 
-            if (fileDataSize > 0)
-            {
-                unsigned char *fileData = (unsigned char *)RAYGUI_MALLOC(fileDataSize*sizeof(unsigned char));
-                fread(fileData, sizeof(unsigned char), fileDataSize, rgsFile);
+                    UnloadCodepoints(codepoints);
 
-                GuiLoadStyleFromMemory(fileData, fileDataSize);
+                    if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
 
-                RAYGUI_FREE(fileData);
+                } break;
+                default: break;
             }
 
-            fclose(rgsFile);
+            line = (lineEnd != NULL)? (lineEnd + 1) : NULL;
         }
     }
+
+    RAYGUI_FREE(fileData);
 }
 
 // Load style default over global style
@@ -4452,6 +4464,7 @@ void GuiLoadStyleDefault(void)
 
         // Setup default raylib font
         guiFont = GetFontDefault();
+        LoadGlyphsWidthCache();
 
         // NOTE: Default raylib font character 95 is a white square
         Rectangle whiteChar = guiFont.recs[95];
@@ -4918,18 +4931,13 @@ static int GetTextWidth(const char *text)
             }
 
             float scaleFactor = fontSize/(float)guiFont.baseSize;
+            float textSpacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
             textSize.y = (float)guiFont.baseSize*scaleFactor;
-            float glyphWidth = 0.0f;
 
             for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
             {
                 int codepoint = GetCodepointNext(&text[i], &codepointSize);
-                int codepointIndex = GetGlyphIndex(guiFont, codepoint);
-
-                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
-
-                textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                textSize.x += (GetGlyphWidth(codepoint)*scaleFactor + textSpacing);
             }
         }
 
@@ -4939,6 +4947,49 @@ static int GetTextWidth(const char *text)
     return (int)textSize.x;
 }
 
+// Gui get glyph width using gui font (unscaled)
+// NOTE: Codepoints in cache range are direct-mapped, no glyph search required
+static float GetGlyphWidth(int codepoint)
+{
+    // Rebuild glyphs width cache in case gui font has been changed
+    if ((guiGlyphsFont.glyphs != guiFont.glyphs) ||
+        (guiGlyphsFont.glyphCount != guiFont.glyphCount) ||
+        (guiGlyphsFont.texture.id != guiFont.texture.id)) LoadGlyphsWidthCache();
+
+    if ((codepoint >= 0) && (codepoint < RAYGUI_GLYPHS_CACHE_SIZE)) return guiGlyphsWidth[codepoint];
+
+    float glyphWidth = 0.0f;
+
+    if (guiFont.glyphs != NULL)
+    {
+        int index = GetGlyphIndex(guiFont, codepoint);
+
+        if (guiFont.glyphs[index].advanceX == 0) glyphWidth = (float)guiFont.recs[index].width;
+        else glyphWidth = (float)guiFont.glyphs[index].advanceX;
+    }
+
+    return glyphWidth;
+}
+
+// Load glyphs width cache for gui font
+static void LoadGlyphsWidthCache(void)
+{
+    for (int codepoint = 0; codepoint < RAYGUI_GLYPHS_CACHE_SIZE; codepoint++)
+    {
+        guiGlyphsWidth[codepoint] = 0.0f;
+
+        if (guiFont.glyphs != NULL)
+        {
+            int index = GetGlyphIndex(guiFont, codepoint);
+
+            if (guiFont.glyphs[index].advanceX == 0) guiGlyphsWidth[codepoint] = (float)guiFont.recs[index].width;
+            else guiGlyphsWidth[codepoint] = (float)guiFont.glyphs[index].advanceX;
+        }
+    }
+
+    guiGlyphsFont = guiFont;
+}
+
 // Get text bounds considering control bounds
 static Rectangle GetTextBounds(int control, Rectangle bounds)
 {
@@ -5043,7 +5094,6 @@ static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
     float width = 0;
     int codepointByteCount = 0;
     int codepoint = 0;
-    int index = 0;
     float glyphWidth = 0;
     float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
 
@@ -5052,8 +5102,7 @@ static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
         if (text[i] != ' ')
         {
             codepoint = GetCodepoint(&text[i], &codepointByteCount);
-            index = GetGlyphIndex(guiFont, codepoint);
-            glyphWidth = (guiFont.glyphs[index].advanceX == 0)? guiFont.recs[index].width*scaleFactor : guiFont.glyphs[index].advanceX*scaleFactor;
+            glyphWidth = GetGlyphWidth(codepoint)*scaleFactor;
             width += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
         }
         else
@@ -5178,15 +5227,13 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
         for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
         {
             int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
-            int index = GetGlyphIndex(guiFont, codepoint);
 
             // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
             // but we need to draw all of the bad bytes using the '?' symbol moving one byte
             if (codepoint == 0x3f) codepointSize = 1; // TODO: Review not recognized codepoints size
 
             // Get glyph width to check if it goes out of bounds
-            if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
-            else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+            glyphWidth = GetGlyphWidth(codepoint)*scaleFactor;
 
             // Wrap mode text measuring, to validate if
             // it can be drawn or a new line is required
@@ -5270,8 +5317,7 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
                     }
                 }
 
-                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                textOffsetX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
             }
         }
 
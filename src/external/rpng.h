@@ -5,13 +5,18 @@
 *   FEATURES:
 *       - Load/Save images from/to raw image data
 *       - Load/Save indexed image data (providing palette)
+*       - Load/Save 1/2/4 bit grayscale and indexed image data (packed scanlines)
 *       - Count/read/write/remove png chunks
 *       - Operate on file or memory buffer
 *       - Chunks data abstraction
 *       - Add custom chunks
+*       - Chunks edit transactions: multiple chunks added/removed on a single rewrite
+*       - Chunks index with zero-copy chunk views, data scanned once
+*       - Pluggable file I/O: user callbacks, memory-mapped reading and atomic writing
 *
 *   LIMITATIONS:
-*       - Bit depths of 1/2/4 bits per pixel not supported, only 8/16 bits
+*       - Bit depths of 1/2/4 bits per pixel only supported for grayscale and indexed images
+*       - Interlaced images not supported
 *
 *   POSSIBLE IMPROVEMENTS:
 *       - Support APNG chunks, added to PNG specs recently (draft)
@@ -31,10 +36,26 @@
 *       #define RPNG_NO_STDIO_WARNING
 *           Skips issuing a compiler warning when RPNG_NO_STDIO is defined.
 *
+*       #define RPNG_FILE_READ_MODE RPNG_FILE_READ_MMAP
+*       #define RPNG_FILE_WRITE_MODE RPNG_FILE_WRITE_ATOMIC
+*           Default file I/O backend, it can also be changed at runtime with rpng_set_file_io().
+*           File reading uses one open per file, memory-mapped if requested; file writing can be
+*           done on a temporary file renamed over the destination.
+*           NOTE: Memory-mapped reading and atomic writing only available on POSIX systems,
+*           stdio backend is used otherwise. Custom backend can be set with rpng_set_file_callbacks()
+*
+*       #define RPNG_DEFLATE_THREADS 4
+*           Compress image data on multiple worker threads (pigz-style), value defines max threads.
+*           Filtered scanlines are split in independent segments, every segment is primed with
+*           previous 32KB as dictionary and all segments are joined into one valid zlib stream
+*           NOTE: Requires RPNG_DEFLATE_IMPLEMENTATION and pthreads (Win32 threads on MSVC)
+*
 *   DEPENDENCIES: libc (C standard library)
 *       stdlib.h        Required for: malloc(), calloc(), free()
 *       string.h        Required for: memcmp(), memcpy()
 *       stdio.h         Required for: FILE, fopen(), fread(), fwrite(), fclose() (only if !RPNG_NO_STDIO)
+*       unistd.h        Required for: open(), read(), write(), close(), rename() (POSIX only)
+*       sys/mman.h      Required for: mmap(), munmap() (POSIX only)
 *
 *       rpng includes internally a copy of sdefl and sinfl libraries by Micha Mettke (@vurtun)
 *       sdelf and sinfl libraries are used for compression and decompression of deflate data streams
@@ -90,6 +111,19 @@
 *       Comment          Miscellaneous comment; conversion from GIF comment
 *
 *   VERSIONS HISTORY:
+*       1.6 (19-Oct-2026) ADDED: Parallel multi-segment deflate for image data (RPNG_DEFLATE_THREADS)
+*                         ADDED: rpng_set_deflate_state_cache(), deflate state reused between compressions
+*                         ADDED: Chunks edit transactions, rpng_chunk_edit_*() (+ memory versions)
+*                         FIXED: rpng_chunk_write_chroma() chunk type and rpng_chunk_write_time() year endianness
+*                         ADDED: Chunks index, rpng_chunk_index_from_memory() and rpng_chunk_view()
+*                         REVIEWED: Chunks reading and image loading use chunks index, CRC validated per chunk read
+*                         REVIEWED: Memory buffers size required for chunks reading and image loading, scan is bounded
+*                         ADDED: Support 1/2/4 bit depths for grayscale and indexed images
+*                         ADDED: rpng_pack_image_data() and rpng_unpack_image_data()
+*                         FIXED: Image data unfiltering for Average and Paeth filters
+*                         ADDED: File I/O backends, rpng_set_file_io() and rpng_set_file_callbacks()
+*                         REVIEWED: File loading opens file once, no previous existence check
+*
 *       1.5 (28-Aug-2024) ADDED: Support indexed data loading and saving (PLTE, tRNS)
 *                         ADDED: rpng_load_image_indexed() (+ memory version)
 *                         ADDED: rpng_save_image_indexed() (+ memory version)
@@ -132,7 +166,7 @@
 #ifndef RPNG_H
 #define RPNG_H
 
-#define RPNG_VERSION    "1.5"
+#define RPNG_VERSION    "1.6"
 
 // Function specifiers in case library is build/used as a shared library (Windows)
 // NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
@@ -176,7 +210,7 @@
 #endif
 
 #ifndef RPNG_MAX_CHUNKS_COUNT
-    // Maximum number of chunks to read
+    // Maximum number of chunks to queue on chunks edit
     #define RPNG_MAX_CHUNKS_COUNT   64
 #endif
 #ifndef RPNG_MAX_OUTPUT_SIZE
@@ -191,6 +225,25 @@
     #define RPNG_COMPRESSION_LEVEL   8
 #endif
 
+#ifndef RPNG_DEFLATE_SEGMENT_SIZE
+    // Filtered image data size compressed by every worker on parallel deflate,
+    // segments are adjusted to full scanlines (only used with RPNG_DEFLATE_THREADS)
+    #define RPNG_DEFLATE_SEGMENT_SIZE   (128*1024)
+#endif
+
+// File I/O backend modes, selectable with rpng_set_file_io()
+#define RPNG_FILE_READ_STDIO         0      // Read file into allocated buffer
+#define RPNG_FILE_READ_MMAP          1      // Map file into memory (POSIX only)
+#define RPNG_FILE_WRITE_STDIO        0      // Write file directly
+#define RPNG_FILE_WRITE_ATOMIC       1      // Write temporary file and rename it over destination (POSIX only)
+
+#ifndef RPNG_FILE_READ_MODE
+    #define RPNG_FILE_READ_MODE     RPNG_FILE_READ_STDIO
+#endif
+#ifndef RPNG_FILE_WRITE_MODE
+    #define RPNG_FILE_WRITE_MODE    RPNG_FILE_WRITE_STDIO
+#endif
+
 // Define some possible error values
 // NOTE: Only some are actually used on file saving
 #define RPNG_SUCCESS                 0      // Image saved successfully
@@ -228,6 +281,42 @@ typedef struct {
     rpng_color *colors;     // Palette colors
 } rpng_palette;
 
+// Chunk info, chunk location on indexed PNG data
+typedef struct {
+    char type[4];           // Chunk type FOURCC
+    int offset;             // Chunk data offset on PNG data (after length and type)
+    int length;             // Chunk data length
+    unsigned int crc;       // 32bit CRC stored on chunk (computed over type and data)
+} rpng_chunk_info;
+
+// Chunks index, generated on a single scan of PNG data
+// NOTE: Chunks data is not copied, indexed data must be valid while index is used
+typedef struct {
+    const char *buffer;         // Indexed PNG data (not owned by index)
+    int size;                   // Indexed PNG data size
+    int count;                  // Chunks count (IEND included)
+    rpng_chunk_info *chunks;    // Chunks info, in data order
+} rpng_chunk_index;
+
+// Chunks edit transaction
+// NOTE: Chunks additions/removals are queued and applied at once on commit
+typedef struct {
+    const char *buffer;                         // Source PNG data
+    bool buffer_owned;                          // Source data loaded from file, freed with edit
+    int buffer_size;                            // Source data size (only required if owned)
+    int buffer_mode;                            // Source data load mode (only required if owned)
+    rpng_chunk add[RPNG_MAX_CHUNKS_COUNT];      // Chunks queued to be added after IHDR
+    int add_count;                              // Chunks queued to be added count
+    char remove[RPNG_MAX_CHUNKS_COUNT][4];      // Chunk types queued to be removed
+    int remove_count;                           // Chunk types queued to be removed count
+} rpng_chunk_edit;
+
+// File I/O callbacks, custom backend (i.e. reading from a package file)
+// NOTE: Data returned by load callback is released with unload callback, size provided
+typedef char *(*rpng_load_file_callback)(const char *filename, int *bytes_read);
+typedef void (*rpng_unload_file_callback)(char *data, int size);
+typedef int (*rpng_save_file_callback)(const char *filename, const void *data, int size);   // Returns RPNG_SUCCESS on success
+
 // A minimal PNG only requires: png_signature | rpng_chunk(IHDR) | rpng_chunk(IDAT) | rpng_chunk(IEND)
 
 #ifdef __cplusplus
@@ -245,7 +334,8 @@ extern "C" {                // Prevents name mangling of functions
 
 // Load a PNG file image data
 //  - Color channels are returned by reference, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
-//  - Bit depth is returned by reference, supported values: 8 bit, 16 bit
+//  - Bit depth is returned by reference, supported values: 8 bit, 16 bit (1/2/4 bit for GRAY and indexed)
+//  - Bit depths 1/2/4 are returned packed, scanlines aligned to byte (use rpng_unpack_image_data())
 //  - In case data can not be loaded, returns NULL
 RPNGAPI char *rpng_load_image(const char *filename, int *width, int *height, int *color_channels, int *bit_depth);
 
@@ -256,7 +346,8 @@ RPNGAPI char *rpng_load_image_indexed(const char *filename, int *width, int *hei
 
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
-//  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
+//  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit (1/2/4 bit for GRAY)
+//  - Bit depths 1/2/4 expect packed data, scanlines aligned to byte (use rpng_pack_image_data())
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth);
 
@@ -264,19 +355,25 @@ RPNGAPI int rpng_save_image(const char *filename, const char *data, int width, i
 //  - Palette colours are saved as RGB888 in PLTE chunk
 //  - Palette alpha is saved as R8 in tRNS chunk (if required)
 //  - Palette max number of entries is limited to [1..256] colors
+//  - Indexes are saved with the smallest bit depth required by palette entries (1/2/4/8 bit)
 //  - Returns saving process result: 0-SUCCESS
 RPNGAPI int rpng_save_image_indexed(const char *filename, const char *indexed_data, int width, int height, rpng_palette palette);
 
 // Load and save png data from memory buffer
 // WARNING: Provided buffer is expected to be PNG compliant, ending with IEND chunk
-RPNGAPI char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth); // Load png data from memory buffer
-RPNGAPI char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *height, rpng_palette *palette); // Load indexed png data from memory buffer (8 bpp)
+RPNGAPI char *rpng_load_image_from_memory(const char *buffer, int size, int *width, int *height, int *color_channels, int *bit_depth); // Load png data from memory buffer
+RPNGAPI char *rpng_load_image_indexed_from_memory(const char *buffer, int size, int *width, int *height, rpng_palette *palette); // Load indexed png data from memory buffer (8 bpp)
 RPNGAPI char *rpng_save_image_to_memory(const char *data, int width, int height, int color_channels, int bit_depth, int *output_size); // Save png data to memory buffer
 RPNGAPI char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int height, rpng_palette palette, int *output_size); // Save indexed data to memory buffer
 
 // Convert indexed image data to RGBA data
 RPNGAPI char *rpng_unindex_image_data(char *indexed_data, int width, int height, rpng_palette palette);
 
+// Pack/unpack 8 bit per pixel data from/to 1/2/4 bit per pixel data (PNG scanlines layout, MSB first)
+// NOTE: Scale maps grayscale values range [0..255] <-> [0..(2^bit_depth - 1)], if not values are kept (indexes)
+RPNGAPI char *rpng_pack_image_data(const char *data, int width, int height, int bit_depth, bool scale);
+RPNGAPI char *rpng_unpack_image_data(const char *packed_data, int width, int height, int bit_depth, bool scale);
+
 // Read and write chunks from file
 RPNGAPI int rpng_chunk_count(const char *filename);                                  // Count the chunks in a PNG image
 RPNGAPI rpng_chunk rpng_chunk_read(const char *filename, const char *chunk_type);    // Read one chunk type
@@ -294,21 +391,54 @@ RPNGAPI void rpng_chunk_write_time(const char *filename, short year, char month,
 RPNGAPI void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters);       // Write pHYs chunk
 RPNGAPI void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y); // Write cHRM chunk
 
+// Chunks edit transaction: queue multiple additions/removals, file is rewritten once on commit
+// NOTE: Edit is released on commit or discard, chunks are added after IHDR in queue order
+RPNGAPI rpng_chunk_edit *rpng_chunk_edit_begin(const char *filename);                  // Begin chunks edit over a PNG file
+RPNGAPI int rpng_chunk_edit_commit(rpng_chunk_edit *edit, const char *filename);       // Apply queued changes and save PNG file
+RPNGAPI void rpng_chunk_edit_discard(rpng_chunk_edit *edit);                           // Discard queued changes
+RPNGAPI void rpng_chunk_edit_add(rpng_chunk_edit *edit, rpng_chunk chunk);             // Queue one new chunk (any kind, data copied)
+RPNGAPI void rpng_chunk_edit_add_text(rpng_chunk_edit *edit, char *keyword, char *text);       // Queue tEXt chunk
+RPNGAPI void rpng_chunk_edit_add_comp_text(rpng_chunk_edit *edit, char *keyword, char *text);  // Queue zTXt chunk, DEFLATE compressed text
+RPNGAPI void rpng_chunk_edit_add_gamma(rpng_chunk_edit *edit, float gamma);                    // Queue gAMA chunk
+RPNGAPI void rpng_chunk_edit_add_srgb(rpng_chunk_edit *edit, char srgb_type);                  // Queue sRGB chunk
+RPNGAPI void rpng_chunk_edit_add_time(rpng_chunk_edit *edit, short year, char month, char day, char hour, char min, char sec); // Queue tIME chunk
+RPNGAPI void rpng_chunk_edit_add_physical_size(rpng_chunk_edit *edit, int pixels_unit_x, int pixels_unit_y, bool meters);    // Queue pHYs chunk
+RPNGAPI void rpng_chunk_edit_add_chroma(rpng_chunk_edit *edit, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y); // Queue cHRM chunk
+RPNGAPI void rpng_chunk_edit_remove(rpng_chunk_edit *edit, const char *chunk_type);    // Queue one chunk type removal (not critical chunks)
+
 // Chunk utilities
 RPNGAPI void rpng_chunk_print_info(const char *filename);                            // Output info about the chunks
-RPNGAPI bool rpng_chunk_check_all_valid(const char *filename);                       // Check chunks CRC is valid
+RPNGAPI bool rpng_chunk_check_all_valid(const char *filename);                       // Check all chunks CRC is valid
 RPNGAPI void rpng_chunk_combine_image_data(const char *filename);                    // Combine multiple IDAT chunks into a single one
 RPNGAPI void rpng_chunk_split_image_data(const char *filename, int split_size);      // Split one IDAT chunk into multiple ones
 
 // Read and write chunks from memory buffer
-RPNGAPI int rpng_chunk_count_from_memory(const char *buffer);                                               // Count the chunks in a PNG image from memory
-RPNGAPI rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_type);                 // Read one chunk type from memory
-RPNGAPI rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count);                        // Read all chunks from memory
+RPNGAPI int rpng_chunk_count_from_memory(const char *buffer, int size);                                     // Count the chunks in a PNG image from memory
+RPNGAPI rpng_chunk rpng_chunk_read_from_memory(const char *buffer, int size, const char *chunk_type);       // Read one chunk type from memory
+RPNGAPI rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int size, int *count);              // Read all chunks from memory
 RPNGAPI char *rpng_chunk_remove_from_memory(const char *buffer, const char *chunk_type, int *output_size);  // Remove one chunk type from memory
 RPNGAPI char *rpng_chunk_remove_ancillary_from_memory(const char *buffer, int *output_size);                // Remove all chunks except: IHDR-IDAT-IEND
 RPNGAPI char *rpng_chunk_write_from_memory(const char *buffer, rpng_chunk chunk, int *output_size);         // Write one new chunk after IHDR (any kind)
 RPNGAPI char *rpng_chunk_combine_image_data_from_memory(char *buffer, int *output_size);                    // Combine multiple IDAT chunks into a single one
 RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int *output_size);      // Split one IDAT chunk into multiple ones
+RPNGAPI rpng_chunk_edit *rpng_chunk_edit_begin_from_memory(const char *buffer);                             // Begin chunks edit over memory buffer (not copied)
+RPNGAPI char *rpng_chunk_edit_commit_to_memory(rpng_chunk_edit *edit, int *output_size);                    // Apply queued changes to new memory buffer (exact size)
+
+// Chunks index and zero-copy chunk views from memory buffer
+RPNGAPI rpng_chunk_index rpng_chunk_index_from_memory(const char *buffer, int size);           // Scan all chunks once (type, offset, length, stored CRC)
+RPNGAPI void rpng_chunk_index_unload(rpng_chunk_index index);                                  // Unload chunks index (indexed data not freed)
+RPNGAPI int rpng_chunk_index_find(rpng_chunk_index index, const char *chunk_type, int start);  // Find chunk type from position, returns -1 if not found
+RPNGAPI rpng_chunk rpng_chunk_view(rpng_chunk_index index, int position);                      // Get chunk pointing to indexed data (do not free chunk.data)
+RPNGAPI bool rpng_chunk_index_check_crc(rpng_chunk_index index, int position);                  // Check indexed chunk CRC is valid (computed on request)
+
+// File I/O backend configuration
+// NOTE: Backend should be set before any file operation, not while a chunks edit is in progress
+RPNGAPI void rpng_set_file_io(int read_mode, int write_mode);      // Set built-in file I/O backend, custom callbacks are reset
+RPNGAPI void rpng_set_file_callbacks(rpng_load_file_callback load, rpng_unload_file_callback unload, rpng_save_file_callback save); // Set custom file I/O callbacks (NULL for built-in)
+
+// Deflate state cache configuration
+// NOTE: Cached state is shared by all single-threaded compressions (not thread-safe), parallel workers keep their own
+RPNGAPI void rpng_set_deflate_state_cache(bool enabled);           // Keep deflate state allocated between compressions, disabling it frees cached state
 
 #ifdef __cplusplus
 }
@@ -331,12 +461,31 @@ RPNGAPI char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_si
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), memcpy()
 
-#if defined(_WIN32) && defined(_MSC_VER)
-    #include <io.h>         // Required for: _access() [file_exists()]
-#else
-    #include <unistd.h>     // Required for: access() (POSIX, not C standard) [file_exists()]
+#if !defined(RPNG_NO_STDIO) && !defined(_WIN32)
+    #define RPNG_FILE_IO_POSIX
+    #include <fcntl.h>      // Required for: open(), O_RDONLY [load_file_to_buffer()]
+    #include <unistd.h>     // Required for: read(), write(), close(), unlink() (POSIX, not C standard)
+    #include <sys/stat.h>   // Required for: fstat(), fchmod(), stat(), umask()
+    #include <sys/mman.h>   // Required for: mmap(), munmap()
+#endif
+
+#if defined(RPNG_DEFLATE_THREADS)
+    #if !defined(RPNG_DEFLATE_IMPLEMENTATION)
+        #error "RPNG_DEFLATE_THREADS requires RPNG_DEFLATE_IMPLEMENTATION (internal sdefl copy)"
+    #endif
+    #if defined(_WIN32) && defined(_MSC_VER)
+        #include <process.h>    // Required for: _beginthreadex() [rpng_deflate_parallel()]
+        // NOTE: Avoid including windows.h, only two functions required
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    #else
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join() [rpng_deflate_parallel()]
+    #endif
 #endif
 
+// File buffer load mode for data loaded with custom callback (internal, not a read mode)
+#define RPNG_FILE_READ_CALLBACK      2
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -474,22 +623,73 @@ typedef struct {
 //----------------------------------------------------------------------------------
 const unsigned char png_signature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a }; // PNG Signature
 
+static int file_read_mode = RPNG_FILE_READ_MODE;        // File reading backend mode
+static int file_write_mode = RPNG_FILE_WRITE_MODE;      // File writing backend mode
+static rpng_load_file_callback load_file_callback = NULL;       // Custom file loading callback
+static rpng_unload_file_callback unload_file_callback = NULL;   // Custom file unloading callback
+static rpng_save_file_callback save_file_callback = NULL;       // Custom file saving callback
+
+static bool deflate_state_cache = false;        // Keep deflate state allocated between compressions
+static struct sdefl *deflate_state = NULL;      // Cached deflate state (~1MB), reused if cache enabled
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+// Deflate state management, cached state returned if available
+static struct sdefl *rpng_deflate_state_acquire(void);
+static void rpng_deflate_state_release(struct sdefl *sde);
+
 // Prefilter and compress image data (image_data -> IDAT chunk.data)
-static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size);
+static char *rpng_inflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size);
 // Decompress and unfilter image data (IDAT chunk.data -> image_data)
 static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type);
 
 // Swap integer from big<->little endian
 static unsigned int swap_endian(unsigned int value);
 static unsigned int compute_crc32(unsigned char *buffer, int size);
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size); // Update CRC32 with more data
 
 // Load/save png file data from/to memory buffer
-static char *load_file_to_buffer(const char *filename, int *bytes_read);
+static char *load_file_to_buffer(const char *filename, int *bytes_read, int *load_mode); // Load mode returned, required to unload
+static void unload_file_buffer(char *data, int size, int load_mode);   // Unload data loaded with load_file_to_buffer()
 static int save_file_from_buffer(const char *filename, void *data, int bytesToWrite);
-static bool file_exists(const char *filename);
+
+// Chunks generation, chunk.data must be freed by caller
+static rpng_chunk rpng_chunk_gen_text(const char *keyword, const char *text);
+static rpng_chunk rpng_chunk_gen_comp_text(const char *keyword, const char *text);
+static rpng_chunk rpng_chunk_gen_gamma(float gamma);
+static rpng_chunk rpng_chunk_gen_srgb(char srgb_type);
+static rpng_chunk rpng_chunk_gen_time(short year, char month, char day, char hour, char min, char sec);
+static rpng_chunk rpng_chunk_gen_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters);
+static rpng_chunk rpng_chunk_gen_chroma(float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y);
+static bool rpng_chunk_edit_removes(const rpng_chunk_edit *edit, const char *chunk_type); // Check chunk type queued for removal
+static const char *rpng_chunk_index_image_data(rpng_chunk_index index, int *size, bool *copied); // Get IDAT data (joined if required)
+
+#if defined(RPNG_DEFLATE_THREADS)
+// Parallel deflate segment, compressed independently by one worker
+typedef struct {
+    const unsigned char *data;  // Segment data (previous data is used as dictionary)
+    int dict_size;              // Dictionary size, previous data available (max 32KB)
+    int size;                   // Segment data size
+    bool last;                  // Last segment flag, it contains final deflate block
+    unsigned char *comp_data;   // Compressed segment data (raw deflate, byte aligned)
+    int comp_size;              // Compressed segment data size
+    unsigned int adler;         // Segment data Adler-32 checksum
+} rpng_deflate_segment;
+
+// Parallel deflate worker, processes segments: first, first + stride, first + 2*stride...
+typedef struct {
+    rpng_deflate_segment *segments;
+    int segment_count;
+    int first;
+    int stride;
+} rpng_deflate_worker;
+
+// Compress filtered image data on multiple threads, generating a valid zlib stream
+static char *rpng_deflate_parallel(const unsigned char *data, int data_size, int scanline_size, int *output_size);
+static void rpng_deflate_worker_process(rpng_deflate_worker *worker);  // Compress assigned segments
+static unsigned int rpng_adler32_combine(unsigned int adler1, unsigned int adler2, int size2); // Combine segments checksums
+#endif
 
 // sdelf and sinfl implementations placed at the end of file
 #define SDEFL_IMPLEMENTATION
@@ -551,6 +751,8 @@ struct sdefl {
 extern int sdefl_bound(int in_len);
 extern int sdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
+extern int sdeflate_segment(struct sdefl *s, void *o, const void *i, int dict_len, int n, int lvl, int is_last);
+extern unsigned sdefl_adler(unsigned adler32, const void *i, int n);
 
 //=========================================================================
 //                           SINFL
@@ -598,18 +800,19 @@ static unsigned char rpng_paeth_predictor(int a, int b, int c)
 
 // Load a PNG file image data
 //  - Color channels are returned by reference, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
-//  - Bit depth is returned by reference, supported values: 8 bit, 16 bit
+//  - Bit depth is returned by reference, supported values: 8 bit, 16 bit (1/2/4 bit for GRAY and indexed, packed)
 char *rpng_load_image(const char *filename, int *width, int *height, int *color_channels, int *bit_depth)
 {
     char *data = NULL;
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
-        data = rpng_load_image_from_memory(file_data, width, height, color_channels, bit_depth);
-        RPNG_FREE(file_data);
+        data = rpng_load_image_from_memory(file_data, file_size, width, height, color_channels, bit_depth);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 
     return data;
@@ -623,12 +826,13 @@ char *rpng_load_image_indexed(const char *filename, int *width, int *height, rpn
     char *data = NULL;
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
-        data = rpng_load_image_indexed_from_memory(file_data, width, height, palette);
-        RPNG_FREE(file_data);
+        data = rpng_load_image_indexed_from_memory(file_data, file_size, width, height, palette);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 
     return data;
@@ -636,7 +840,7 @@ char *rpng_load_image_indexed(const char *filename, int *width, int *height, rpn
 
 // Save a PNG file from image data (IHDR, IDAT, IEND)
 //  - Color channels defines pixel color channels, supported values: 1 (GRAY), 2 (GRAY+ALPHA), 3 (RGB), 4 (RGBA)
-//  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit
+//  - Bit depth defines every color channel size, supported values: 8 bit, 16 bit (1/2/4 bit for GRAY, packed)
 int rpng_save_image(const char *filename, const char *data, int width, int height, int color_channels, int bit_depth)
 {
     int result = 0;
@@ -681,12 +885,13 @@ int rpng_chunk_count(const char *filename)
 {
     int count = 0;
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
-        count = rpng_chunk_count_from_memory(file_data);
-        RPNG_FREE(file_data);
+        count = rpng_chunk_count_from_memory(file_data, file_size);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 
     return count;
@@ -699,12 +904,13 @@ rpng_chunk rpng_chunk_read(const char *filename, const char *chunk_type)
     rpng_chunk chunk = { 0 };
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
-        chunk = rpng_chunk_read_from_memory(file_data, chunk_type);
-        RPNG_FREE(file_data);
+        chunk = rpng_chunk_read_from_memory(file_data, file_size, chunk_type);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 
     return chunk;
@@ -717,12 +923,13 @@ rpng_chunk *rpng_chunk_read_all(const char *filename, int *count)
     rpng_chunk *chunks = NULL;
 
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
-        chunks = rpng_chunk_read_all_from_memory(file_data, &counter);
-        RPNG_FREE(file_data);
+        chunks = rpng_chunk_read_all_from_memory(file_data, file_size, &counter);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 
     *count = counter;
@@ -733,7 +940,8 @@ rpng_chunk *rpng_chunk_read_all(const char *filename, int *count)
 void rpng_chunk_remove(const char *filename, const char *chunk_type)
 {
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
@@ -742,7 +950,7 @@ void rpng_chunk_remove(const char *filename, const char *chunk_type)
         save_file_from_buffer(filename, file_output, file_output_size);
 
         RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 }
 
@@ -750,7 +958,8 @@ void rpng_chunk_remove(const char *filename, const char *chunk_type)
 void rpng_chunk_remove_ancillary(const char *filename)
 {
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
@@ -759,7 +968,7 @@ void rpng_chunk_remove_ancillary(const char *filename)
         save_file_from_buffer(filename, file_output, file_output_size);
 
         RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 }
 
@@ -768,7 +977,8 @@ void rpng_chunk_remove_ancillary(const char *filename)
 void rpng_chunk_write(const char *filename, rpng_chunk chunk)
 {
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     int file_output_size = 0;
     char *file_output = NULL;
@@ -782,7 +992,7 @@ void rpng_chunk_write(const char *filename, rpng_chunk chunk)
         else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
 
         RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 }
 
@@ -804,36 +1014,9 @@ void rpng_chunk_write(const char *filename, rpng_chunk chunk)
 //   Comment          Miscellaneous comment
 void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    if (file_data != NULL)
-    {
-        rpng_chunk chunk = { 0 };
-
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
-
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "tEXt", 4);
-        chunk.length = keyword_len + 1 + text_len;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 1, text, text_len);
-        chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk chunk = rpng_chunk_gen_text(keyword, text);
+    rpng_chunk_write(filename, chunk);
+    RPNG_FREE(chunk.data);
 }
 
 // Write zTXt chunk, DEFLATE compressed text
@@ -843,79 +1026,18 @@ void rpng_chunk_write_text(const char *filename, char *keyword, char *text)
 //    unsigned char *comp_text;         // Compressed text: n bytes
 void rpng_chunk_write_comp_text(const char *filename, char *keyword, char *text)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    if (file_data != NULL)
-    {
-        // Create chunk and fill with data
-        rpng_chunk chunk = { 0 };
-
-        int keyword_len = (int)strlen(keyword);
-        int text_len = (int)strlen(text);
-
-        // Compress filtered image data and generate a valid zlib stream
-        struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
-        int bounds = sdefl_bound(text_len);
-        unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
-        int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, RPNG_COMPRESSION_LEVEL);
-        RPNG_FREE(sde);
-
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "zTXt", 4);
-        chunk.length = keyword_len + 1 + 1 + comp_text_size;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        memcpy(chunk.data, keyword, keyword_len);
-        memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
-
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(comp_text);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk chunk = rpng_chunk_gen_comp_text(keyword, text);
+    rpng_chunk_write(filename, chunk);
+    RPNG_FREE(chunk.data);
 }
 
 // Write gAMA chunk
 // NOTE: Gamma is stored as one int: gamma*100000
 void rpng_chunk_write_gamma(const char *filename, float gamma)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    if (file_data != NULL)
-    {
-        rpng_chunk chunk = { 0 };
-
-        int gamma_value = (int)(gamma*100000);
-
-        // Fill chunk with required data
-        // NOTE: CRC can be left to 0, it's calculated internally on writing
-        memcpy(chunk.type, "gAMA", 4);
-        chunk.length = 4;
-        chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-        gamma_value = swap_endian(gamma_value);
-        memcpy(chunk.data, &gamma_value, 4);
-        chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-        int file_output_size = 0;
-        char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-        // Verify expected output size before writing to file
-        if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-        else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
-        RPNG_FREE(chunk.data);
-        RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
-    }
+    rpng_chunk chunk = rpng_chunk_gen_gamma(gamma);
+    rpng_chunk_write(filename, chunk);
+    RPNG_FREE(chunk.data);
 }
 
 // Write sRGB chunk, requires gAMA chunk
@@ -926,31 +1048,9 @@ void rpng_chunk_write_gamma(const char *filename, float gamma)
 //   3: Absolute colorimetric
 void rpng_chunk_write_srgb(const char *filename, char srgb_type)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    if ((srgb_type < 0) || (srgb_type > 3)) srgb_type = 0;
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "sRGB", 4);
-    chunk.length = 1;
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, &srgb_type, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = rpng_chunk_gen_srgb(srgb_type);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write tIME chunk
@@ -963,34 +1063,9 @@ void rpng_chunk_write_srgb(const char *filename, char srgb_type)
 //   unsigned char second;        // 0 to 60 (yes, 60, for leap seconds; not 61, a common error)
 void rpng_chunk_write_time(const char *filename, short year, char month, char day, char hour, char min, char sec)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "tIME", 4);
-    chunk.length = 7;
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    memcpy(chunk.data, &year, 2);
-    memcpy(chunk.data + 2, &month, 1);
-    memcpy(chunk.data + 3, &day, 1);
-    memcpy(chunk.data + 4, &hour, 1);
-    memcpy(chunk.data + 5, &min, 1);
-    memcpy(chunk.data + 6, &sec, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = rpng_chunk_gen_time(year, month, day, hour, min, sec);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write pHYs chunk
@@ -1000,34 +1075,9 @@ void rpng_chunk_write_time(const char *filename, short year, char month, char da
 //   unsigned char unit_specifier;       // 0 - Unit unknown, 1 - Unit is meter
 void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int pixels_unit_y, bool meters)
 {
-    int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
-
-    rpng_chunk chunk = { 0 };
-
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
-    chunk.length = 9;
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    pixels_unit_x = swap_endian(pixels_unit_x);
-    memcpy(chunk.data, &pixels_unit_x, 4);
-    pixels_unit_y = swap_endian(pixels_unit_y);
-    memcpy(chunk.data + 4, &pixels_unit_y, 4);
-    char meters_value = (meters)? 1 : 0;
-    memcpy(chunk.data + 8, &meters_value, 1);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
-
-    int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
-
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
-
+    rpng_chunk chunk = rpng_chunk_gen_physical_size(pixels_unit_x, pixels_unit_y, meters);
+    rpng_chunk_write(filename, chunk);
     RPNG_FREE(chunk.data);
-    RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
 }
 
 // Write cHRM chunk
@@ -1043,44 +1093,55 @@ void rpng_chunk_write_physical_size(const char *filename, int pixels_unit_x, int
 // NOTE: Each value is stored as one int: value*100000
 void rpng_chunk_write_chroma(const char *filename, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
 {
+    rpng_chunk chunk = rpng_chunk_gen_chroma(white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y);
+    rpng_chunk_write(filename, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Begin chunks edit transaction over a PNG file
+// NOTE: File is loaded once, changes are only applied on rpng_chunk_edit_commit()
+rpng_chunk_edit *rpng_chunk_edit_begin(const char *filename)
+{
+    rpng_chunk_edit *edit = NULL;
+
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
-    rpng_chunk chunk = { 0 };
+    if (file_data != NULL)
+    {
+        edit = rpng_chunk_edit_begin_from_memory(file_data);
 
-    // Fill chunk with required data
-    // NOTE: CRC can be left to 0, it's calculated internally on writing
-    memcpy(chunk.type, "pHYs", 4);
-    chunk.length = 8*4;     // 8 integer values
-    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
-    int white_x_value = swap_endian((int)(white_x*100000));
-    memcpy(chunk.data, &white_x_value, 4);
-    int white_y_value = swap_endian((int)(white_y*100000));
-    memcpy(chunk.data + 4, &white_y_value, 4);
-    int red_x_value = swap_endian((int)(red_x*100000));
-    memcpy(chunk.data + 8, &red_x_value, 4);
-    int red_y_value = swap_endian((int)(red_y*100000));
-    memcpy(chunk.data + 12, &red_y_value, 4);
-    int green_x_value = swap_endian((int)(green_x*100000));
-    memcpy(chunk.data + 16, &green_x_value, 4);
-    int green_y_value = swap_endian((int)(green_y*100000));
-    memcpy(chunk.data + 20, &green_y_value, 4);
-    int blue_x_value = swap_endian((int)(blue_x*100000));
-    memcpy(chunk.data + 24, &blue_x_value, 4);
-    int blue_y_value = swap_endian((int)(blue_y*100000));
-    memcpy(chunk.data + 28, &blue_y_value, 4);
-    chunk.crc = 0;  // Computed by rpng_chunk_write_from_memory()
+        if (edit != NULL)
+        {
+            edit->buffer_owned = true;
+            edit->buffer_size = file_size;
+            edit->buffer_mode = file_mode;
+        }
+        else unload_file_buffer(file_data, file_size, file_mode);
+    }
+
+    return edit;
+}
+
+// Commit chunks edit transaction to a PNG file
+// NOTE: Output is generated in a single pass and file written once, edit is released
+int rpng_chunk_edit_commit(rpng_chunk_edit *edit, const char *filename)
+{
+    int result = RPNG_ERROR_MEMORY_ALLOC;
 
     int file_output_size = 0;
-    char *file_output = rpng_chunk_write_from_memory(file_data, chunk, &file_output_size);
+    char *file_output = rpng_chunk_edit_commit_to_memory(edit, &file_output_size);
 
-    // Verify expected output size before writing to file
-    if (file_output_size == (file_size + chunk.length + 12)) save_file_from_buffer(filename, file_output, file_output_size);
-    else RPNG_LOG("WARNING: Failed to save file, output size not matching expected size\n");
+    if ((file_output != NULL) && (file_output_size > 0))
+    {
+        result = save_file_from_buffer(filename, file_output, file_output_size);
+    }
+    else RPNG_LOG("WARNING: PNG chunks edit commit failed\n");
 
-    RPNG_FREE(chunk.data);
     RPNG_FREE(file_output);
-    RPNG_FREE(file_data);
+
+    return result;
 }
 
 // Output info about the chunks
@@ -1113,39 +1174,32 @@ void rpng_chunk_print_info(const char *filename)
     RPNG_FREE(chunks);
 }
 
-// Check chunks CRC and order
+// Check chunks CRC is valid
 bool rpng_chunk_check_all_valid(const char *filename)
 {
-    bool result = true;
-
-    int count = 0;
-    rpng_chunk *chunks = rpng_chunk_read_all(filename, &count);
-    if (chunks == NULL) return false;
+    bool result = false;
 
-    unsigned int crc = 0;
-    char *chunk_type_data = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1);
+    int file_size = 0;
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
-    if (chunk_type_data != NULL)
+    if (file_data != NULL)
     {
-        for (int i = 0; i < count; i++)
-        {
-            memcpy(chunk_type_data, chunks[i].type, 4);
-            memcpy(chunk_type_data + 4, chunks[i].data, chunks[i].length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunks[i].length);
-            crc = swap_endian(crc);
+        rpng_chunk_index index = rpng_chunk_index_from_memory(file_data, file_size);
 
-            // Check computed CRC matches provided CRC
-            if (chunks[i].crc != crc)
+        result = (index.count > 0);
+        for (int i = 0; i < index.count; i++)
+        {
+            if (!rpng_chunk_index_check_crc(index, i))
             {
                 result = false;
                 break;
             }
         }
-    }
 
-    // Free chunks memory
-    for (int i = 0; i < count; i++) RPNG_FREE(chunks[i].data);
-    RPNG_FREE(chunks);
+        rpng_chunk_index_unload(index);
+        unload_file_buffer(file_data, file_size, file_mode);
+    }
 
     return result;
 }
@@ -1154,7 +1208,8 @@ bool rpng_chunk_check_all_valid(const char *filename)
 void rpng_chunk_combine_image_data(const char *filename)
 {
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
@@ -1168,7 +1223,7 @@ void rpng_chunk_combine_image_data(const char *filename)
         }
 
         RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 }
 
@@ -1176,7 +1231,8 @@ void rpng_chunk_combine_image_data(const char *filename)
 void rpng_chunk_split_image_data(const char *filename, int split_size)
 {
     int file_size = 0;
-    char *file_data = load_file_to_buffer(filename, &file_size);
+    int file_mode = 0;
+    char *file_data = load_file_to_buffer(filename, &file_size, &file_mode);
 
     if (file_data != NULL)
     {
@@ -1190,23 +1246,33 @@ void rpng_chunk_split_image_data(const char *filename, int split_size)
         }
 
         RPNG_FREE(file_output);
-        RPNG_FREE(file_data);
+        unload_file_buffer(file_data, file_size, file_mode);
     }
 }
 
 // Functions operating on memory buffers data
 //----------------------------------------------------------------------------------------------------------
 // Load png data from memory buffer
-char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, int *color_channels, int *bit_depth)
+char *rpng_load_image_from_memory(const char *buffer, int size, int *width, int *height, int *color_channels, int *bit_depth)
 {
     char *data = NULL;
 
-    rpng_chunk chunk_info = rpng_chunk_read_from_memory(buffer, "IHDR");
+    // NOTE: All required chunks are located on a single scan of the data
+    rpng_chunk_index index = rpng_chunk_index_from_memory(buffer, size);
+    int ihdr_position = rpng_chunk_index_find(index, "IHDR", 0);
 
-    if (chunk_info.data == NULL) return data; // WARNING: Return if no info chunk has been loaded
+    // WARNING: Return if no valid info chunk is available
+    if ((ihdr_position < 0) || (index.chunks[ihdr_position].length < 13))
+    {
+        rpng_chunk_index_unload(index);
+        return data;
+    }
 
     // First chunk is always IHDR, we can check image data info
-    rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunk_info.data;
+    // NOTE: IHDR data is copied to avoid unaligned access on source buffer
+    rpng_chunk_IHDR IHDRHeader = { 0 };
+    memcpy(&IHDRHeader, rpng_chunk_view(index, ihdr_position).data, 13);
+    rpng_chunk_IHDR *IHDRData = &IHDRHeader;
 
     *width = swap_endian(IHDRData->width);      // Image width
     *height = swap_endian(IHDRData->height);    // Image height
@@ -1223,8 +1289,17 @@ char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, i
         default: break;
     }
 
-    // TODO: Support bit depths of 1/2/4 bits? -> Convert to 8bit grayscale
-    if ((*color_channels == 1) && (*bit_depth != 8) && (*bit_depth != 16)) return data;  // Bit depth 1/2/4 not supported
+    // Verify bit depth is supported by pixel format
+    // NOTE: Bit depths 1/2/4 are only valid for grayscale (0) and indexed (3), 16 bit not valid for indexed
+    bool bit_depth_valid = ((*bit_depth == 8) || ((*bit_depth == 16) && (IHDRData->color_type != 3)));
+    if ((IHDRData->color_type == 0) || (IHDRData->color_type == 3)) bit_depth_valid |= ((*bit_depth == 1) || (*bit_depth == 2) || (*bit_depth == 4));
+
+    if (!bit_depth_valid)
+    {
+        RPNG_LOG("WARNING: Image bit depth (%i bit per channel) not supported\n", *bit_depth);
+        rpng_chunk_index_unload(index);
+        return data;
+    }
 
     // Additional info provided by IHDR (in case it was required)
     //IHDRData->compression;        // Compression method: 0 (DEFLATE)
@@ -1233,52 +1308,51 @@ char *rpng_load_image_from_memory(const char *buffer, int *width, int *height, i
 
     if (*color_channels != 0)
     {
-        // NOTE: All splitted chunks are joined on reading
-        rpng_chunk chunk_image = rpng_chunk_read_from_memory(buffer, "IDAT");
+        // NOTE: All splitted chunks are joined on reading, every IDAT chunk CRC is validated
+        int image_data_size = 0;
+        bool image_data_copied = false;
+        const char *image_data = rpng_chunk_index_image_data(index, &image_data_size, &image_data_copied);
 
-        if (chunk_image.data != NULL)
+        if (image_data != NULL)
         {
-            // Verify data integrity CRC over all chunk data concatenated
-            unsigned int crc = 0;
-            char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-            memcpy(chunk_type_data, chunk_image.type, 4);
-            memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-            crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-            RPNG_FREE(chunk_type_data);
-
-            if (crc == chunk_image.crc) // Validate crc
-            {
-                int pixel_size = *color_channels*(*bit_depth/8);
-                data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, *width, *height, pixel_size);
+            // NOTE: Bit depths 1/2/4 are kept packed, unfiltering is done at byte level
+            int pixel_bits = *color_channels*(*bit_depth);
+            int scanline_size = (*width*pixel_bits + 7)/8;
+            int pixel_size = (pixel_bits < 8)? 1 : pixel_bits/8;
+            data = rpng_inflate_image_data(image_data, image_data_size, scanline_size/pixel_size, *height, pixel_size);
 
-                if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
-            }
-            else RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
-        }
+            if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
 
-        RPNG_FREE(chunk_image.data);
+            if (image_data_copied) RPNG_FREE((char *)image_data);
+        }
     }
     else RPNG_LOG("WARNING: Failed to load file, image pixel format not supported\n");
 
-    RPNG_FREE(chunk_info.data);
+    rpng_chunk_index_unload(index);
 
     return data;
 }
 
 // Load indexed png data (including palette) from memory buffer
 // NOTE: Returns indexed data as an index byte array (8bit) along the palette data (PLTE - RGB888 - 24bit)
-char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *height, rpng_palette *palette)
+char *rpng_load_image_indexed_from_memory(const char *buffer, int size, int *width, int *height, rpng_palette *palette)
 {
     char *data = NULL;
     *width = 0;
     *height = 0;
 
+    // NOTE: All required chunks are located on a single scan of the data
+    rpng_chunk_index index = rpng_chunk_index_from_memory(buffer, size);
+
     // Load indexed palette data, if provided
     // Start verifying it contains palette/indexed data, if not we finish
-    rpng_chunk chunk_palette = rpng_chunk_read_from_memory(buffer, "PLTE");
+    int plte_position = rpng_chunk_index_find(index, "PLTE", 0);
+    int ihdr_position = rpng_chunk_index_find(index, "IHDR", 0);
 
-    if (chunk_palette.data != NULL)
+    if ((plte_position >= 0) && (ihdr_position >= 0) && (index.chunks[ihdr_position].length >= 13))
     {
+        rpng_chunk chunk_palette = rpng_chunk_view(index, plte_position);
+
         // Palette data is provided as RGB888
         palette->color_count = chunk_palette.length/3;
         palette->colors = (rpng_color *)RPNG_CALLOC(palette->color_count, sizeof(rpng_color));
@@ -1291,59 +1365,55 @@ char *rpng_load_image_indexed_from_memory(const char *buffer, int *width, int *h
             palette->colors[i].a = 255;
         }
 
-        RPNG_FREE(chunk_palette.data);
-
-        // Try loading palette alpha data, if provided 
-        rpng_chunk chunk_alpha = rpng_chunk_read_from_memory(buffer, "tRNS");
+        // Try loading palette alpha data, if provided
+        int trns_position = rpng_chunk_index_find(index, "tRNS", 0);
 
-        if ((chunk_alpha.data != NULL) && (chunk_alpha.length == palette->color_count))
+        if ((trns_position >= 0) && (index.chunks[trns_position].length == palette->color_count))
         {
-            for (int i = 0; i < palette->color_count; i++) palette->colors[i].a = (unsigned char)chunk_alpha.data[i];
+            rpng_chunk chunk_alpha = rpng_chunk_view(index, trns_position);
 
-            RPNG_FREE(chunk_alpha.data);
+            for (int i = 0; i < palette->color_count; i++) palette->colors[i].a = (unsigned char)chunk_alpha.data[i];
         }
 
         // Load indexed image data
-        rpng_chunk chunk_info = rpng_chunk_read_from_memory(buffer, "IHDR");
-
-        // WARNING: Cast chunk_info data directly to expected IHDR struct layout
-        rpng_chunk_IHDR *IHDRData = (rpng_chunk_IHDR *)chunk_info.data;
+        // NOTE: IHDR data is copied to avoid unaligned access on source buffer
+        rpng_chunk_IHDR IHDRHeader = { 0 };
+        memcpy(&IHDRHeader, rpng_chunk_view(index, ihdr_position).data, 13);
+        rpng_chunk_IHDR *IHDRData = &IHDRHeader;
 
         *width = swap_endian(IHDRData->width);      // Image width
         *height = swap_endian(IHDRData->height);    // Image height
 
-        // Verify color type is indexed (3) and bit depth is 8
-        if ((IHDRData->color_type == 3) && (IHDRData->bit_depth == 8))
+        // Verify color type is indexed (3) and bit depth is 1/2/4/8
+        if ((IHDRData->color_type == 3) &&
+            ((IHDRData->bit_depth == 1) || (IHDRData->bit_depth == 2) || (IHDRData->bit_depth == 4) || (IHDRData->bit_depth == 8)))
         {
-            // NOTE: All splitted chunks are joined on reading
-            rpng_chunk chunk_image = rpng_chunk_read_from_memory(buffer, "IDAT");
+            // NOTE: All splitted chunks are joined on reading, every IDAT chunk CRC is validated
+            int image_data_size = 0;
+            bool image_data_copied = false;
+            const char *image_data = rpng_chunk_index_image_data(index, &image_data_size, &image_data_copied);
 
-            if (chunk_image.data != NULL)
+            if (image_data != NULL)
             {
-                // Verify data integrity CRC over all chunk data concatenated
-                unsigned int crc = 0;
-                char *chunk_type_data = (char *)RPNG_CALLOC(4 + chunk_image.length, 1);
-                memcpy(chunk_type_data, chunk_image.type, 4);
-                memcpy(chunk_type_data + 4, chunk_image.data, chunk_image.length);
-                crc = compute_crc32((unsigned char *)chunk_type_data, 4 + chunk_image.length);
-                RPNG_FREE(chunk_type_data);
-
-                if (crc == chunk_image.crc) // Validate crc
-                {
-                    int pixel_size = (IHDRData->bit_depth/8); // NOTE: Assume 1 channel
-                    data = rpng_inflate_image_data(chunk_image.data, chunk_image.length, *width, *height, pixel_size);
+                // NOTE: Indexes are always returned as 8 bit, sub-byte indexes are unpacked
+                int scanline_size = (*width*IHDRData->bit_depth + 7)/8;
+                data = rpng_inflate_image_data(image_data, image_data_size, scanline_size, *height, 1);
 
-                    if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
+                if (data == NULL) RPNG_LOG("WARNING: IDAT image data decompression failed\n");
+                else if (IHDRData->bit_depth < 8)
+                {
+                    char *unpacked_data = rpng_unpack_image_data(data, *width, *height, IHDRData->bit_depth, false);
+                    RPNG_FREE(data);
+                    data = unpacked_data;
                 }
-                else RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
-            }
 
-            RPNG_FREE(chunk_image.data);
+                if (image_data_copied) RPNG_FREE((char *)image_data);
+            }
         }
-
-        RPNG_FREE(chunk_info.data);
     }
 
+    rpng_chunk_index_unload(index);
+
     return data;
 }
 
@@ -1353,10 +1423,12 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
     char *output_buffer = NULL;
     int output_buffer_size = 0;
 
-    if ((bit_depth != 8) && (bit_depth != 16))
+    // NOTE: Bit depths 1/2/4 only supported for grayscale data
+    if ((bit_depth != 8) && (bit_depth != 16) &&
+        !((color_channels == 1) && ((bit_depth == 1) || (bit_depth == 2) || (bit_depth == 4))))
     {
         RPNG_LOG("WARNING: Requested bit depth (%i bit per channel) not supported\n", bit_depth);
-        return output_buffer;  // WARNING: Bit depth 1/2/4 not supported
+        return output_buffer;
     }
 
     int color_type = -1;
@@ -1374,9 +1446,12 @@ char *rpng_save_image_to_memory(const char *data, int width, int height, int col
     image_info.color_type = (unsigned char)color_type;
 
     // Image data pre-processing to append filter type byte to every scanline
-    int pixel_size = color_channels*(bit_depth/8);
+    // NOTE: Bit depths 1/2/4 data is packed, filtered at byte level with no filter (recommended by PNG spec)
+    int pixel_bits = color_channels*bit_depth;
+    int scanline_size = (width*pixel_bits + 7)/8;
+    int pixel_size = (pixel_bits < 8)? 1 : pixel_bits/8;
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, -1);
+    char *comp_data = rpng_deflate_image_data(data, scanline_size*height, scanline_size/pixel_size, height, pixel_size, &comp_data_size, (pixel_bits < 8)? 0 : -1);
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
@@ -1426,16 +1501,32 @@ char *rpng_save_image_indexed_to_memory(const char *indexed_data, int width, int
     char *output_buffer = NULL;
     int output_buffer_size = 0;
 
+    // Use the smallest bit depth able to store all palette indexes
+    int bit_depth = 8;
+    if (palette.color_count <= 2) bit_depth = 1;
+    else if (palette.color_count <= 4) bit_depth = 2;
+    else if (palette.color_count <= 16) bit_depth = 4;
+
     rpng_chunk_IHDR image_info = { 0 };
     image_info.width = swap_endian(width);
     image_info.height = swap_endian(height);
-    image_info.bit_depth = 8;  // WARNING: Indexed data assumes 8-bit indexes
+    image_info.bit_depth = (unsigned char)bit_depth;
     image_info.color_type = 3; // NOTE: Indexed data requires 3
 
+    // Pack indexes if required, provided indexed data is 8 bit
+    const char *image_data = indexed_data;
+    char *packed_data = NULL;
+    if (bit_depth < 8)
+    {
+        packed_data = rpng_pack_image_data(indexed_data, width, height, bit_depth, false);
+        image_data = packed_data;
+    }
+
     // Image data pre-processing to append filter type byte to every scanline
-    int pixel_size = 1; // 1 byte per pixel (indexed data)
+    int scanline_size = (width*bit_depth + 7)/8;
     int comp_data_size = 0;
-    char *comp_data = rpng_deflate_image_data(indexed_data, width*height*pixel_size, width, height, pixel_size, &comp_data_size, 0);
+    char *comp_data = rpng_deflate_image_data(image_data, scanline_size*height, scanline_size, height, 1, &comp_data_size, 0);
+    RPNG_FREE(packed_data);
 
     // Security check to verify compression worked
     if ((comp_data != NULL) && (comp_data_size > 0))
@@ -1549,153 +1640,284 @@ char *rpng_unindex_image_data(char *indexed_data, int width, int height, rpng_pa
     return data;
 }
 
-//-------------------------------------------------------------------------------------------------
-// PNG chunks managemeng functionality
-//-------------------------------------------------------------------------------------------------
-
-// Count the chunks in a PNG image from memory buffer
-int rpng_chunk_count_from_memory(const char *buffer)
+// Pack 8 bit per pixel data into 1/2/4 bit per pixel data
+//  - Pixels are packed MSB first, every scanline starts on a new byte (PNG scanlines layout)
+//  - Scale maps grayscale values [0..255] to bit depth range, if not values are truncated (indexes)
+char *rpng_pack_image_data(const char *data, int width, int height, int bit_depth, bool scale)
 {
-    char *buffer_ptr = (char *)buffer;
-    int count = 0;
+    char *packed_data = NULL;
 
-    // NOTE: We check minimum file_size for a PNG (Signature + chunk IHDR + chunk IDAT + chunk IEND)
-    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file
+    if ((data != NULL) && ((bit_depth == 1) || (bit_depth == 2) || (bit_depth == 4)))
     {
-        buffer_ptr += 8;       // Move pointer after signature
+        int scanline_size = (width*bit_depth + 7)/8;
+        int max_value = (1 << bit_depth) - 1;
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        packed_data = (char *)RPNG_CALLOC(scanline_size*height, 1);
 
-        while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+        for (int y = 0; (packed_data != NULL) && (y < height); y++)
         {
-            buffer_ptr += (4 + 4 + chunk_size + 4);    // Skip chunk Length + FOURCC + chunk data + CRC32
+            unsigned char *scanline = (unsigned char *)packed_data + y*scanline_size;
 
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
-            count++;
+            for (int x = 0; x < width; x++)
+            {
+                int value = ((const unsigned char *)data)[y*width + x];
+                value = (scale)? (value >> (8 - bit_depth)) : (value & max_value);
+
+                scanline[(x*bit_depth)/8] |= (unsigned char)(value << (8 - bit_depth - (x*bit_depth)%8));
+            }
         }
+    }
+    else RPNG_LOG("WARNING: Data can not be packed, bit depth (%i) not supported\n", bit_depth);
+
+    return packed_data;
+}
+
+// Unpack 1/2/4 bit per pixel data into 8 bit per pixel data
+//  - Pixels are expected packed MSB first, every scanline starting on a new byte (PNG scanlines layout)
+//  - Scale maps bit depth range to grayscale values [0..255], if not values are kept (indexes)
+char *rpng_unpack_image_data(const char *packed_data, int width, int height, int bit_depth, bool scale)
+{
+    char *data = NULL;
+
+    if ((packed_data != NULL) && ((bit_depth == 1) || (bit_depth == 2) || (bit_depth == 4)))
+    {
+        int scanline_size = (width*bit_depth + 7)/8;
+        int max_value = (1 << bit_depth) - 1;
+
+        data = (char *)RPNG_MALLOC(width*height);
+
+        for (int y = 0; (data != NULL) && (y < height); y++)
+        {
+            const unsigned char *scanline = (const unsigned char *)packed_data + y*scanline_size;
 
-        count++; // IEND chunk!
+            for (int x = 0; x < width; x++)
+            {
+                int value = (scanline[(x*bit_depth)/8] >> (8 - bit_depth - (x*bit_depth)%8)) & max_value;
+
+                ((unsigned char *)data)[y*width + x] = (unsigned char)((scale)? (value*255/max_value) : value);
+            }
+        }
     }
+    else RPNG_LOG("WARNING: Data can not be unpacked, bit depth (%i) not supported\n", bit_depth);
+
+    return data;
+}
+
+//-------------------------------------------------------------------------------------------------
+// PNG chunks managemeng functionality
+//-------------------------------------------------------------------------------------------------
+
+// Count the chunks in a PNG image from memory buffer
+int rpng_chunk_count_from_memory(const char *buffer, int size)
+{
+    rpng_chunk_index index = rpng_chunk_index_from_memory(buffer, size);
+    int count = index.count;
+    rpng_chunk_index_unload(index);
 
     return count;
 }
 
 // Read one chunk type from memory buffer
-rpng_chunk rpng_chunk_read_from_memory(const char *buffer, const char *chunk_type)
+// NOTE: Returned chunk data is a copy, it must be freed by user
+rpng_chunk rpng_chunk_read_from_memory(const char *buffer, int size, const char *chunk_type)
 {
-    char *buffer_ptr = (char *)buffer;
     rpng_chunk chunk = { 0 };
 
-    // NOTE: We check minimum file_size for a PNG (Signature + chunk IHDR + chunk IDAT + chunk IEND)
-    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file
-    {
-        buffer_ptr += 8;   // Move pointer after signature
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+    rpng_chunk_index index = rpng_chunk_index_from_memory(buffer, size);
+    int position = rpng_chunk_index_find(index, chunk_type, 0);
 
+    if (position >= 0)
+    {
         // In case chunk(s) requested is IDAT, all IDAT chunks are concatenated
         if (memcmp(chunk_type, "IDAT", 4) == 0)
         {
-            char *idat_data_concat = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, sizeof(char));
             int idat_data_concat_size = 0;
+            unsigned int crc = update_crc32(0, (const unsigned char *)"IDAT", 4);
 
-            while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+            for (int i = position; i < index.count; i++)
             {
-                if (memcmp(buffer_ptr + 4, chunk_type, 4) == 0) // Check next IDAT chunk
+                if (memcmp(index.chunks[i].type, "IDAT", 4) == 0) idat_data_concat_size += index.chunks[i].length;
+            }
+
+            // Fill chunk data with all accumulated IDAT, exact size allocation
+            chunk.length = idat_data_concat_size;
+            memcpy(chunk.type, "IDAT", 4);
+            chunk.data = (char *)RPNG_MALLOC((idat_data_concat_size > 0)? idat_data_concat_size : 1);
+
+            for (int i = position, offset = 0; i < index.count; i++)
+            {
+                if (memcmp(index.chunks[i].type, "IDAT", 4) == 0)
                 {
-                    memcpy(idat_data_concat + idat_data_concat_size, (char *)(buffer_ptr + 8), chunk_size);
-                    idat_data_concat_size += chunk_size;
+                    const unsigned char *idat_data = (const unsigned char *)index.buffer + index.chunks[i].offset;
 
-                    // TODO: Validate every IDAT chunk CRC32
-                }
+                    memcpy(chunk.data + offset, idat_data, index.chunks[i].length);
+                    crc = update_crc32(crc, idat_data, index.chunks[i].length);
+                    offset += index.chunks[i].length;
 
-                buffer_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
-                chunk_size = swap_endian(((int *)buffer_ptr)[0]); // Compute next chunk file_size
+                    if (!rpng_chunk_index_check_crc(index, i)) RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+                }
             }
 
-            // Fill chunk data with all accumulated IDAT
-            chunk.length = idat_data_concat_size;
-            memcpy(chunk.type, "IDAT", 4);
-            chunk.data = (char *)RPNG_CALLOC(idat_data_concat_size, sizeof(char));
-            memcpy(chunk.data, idat_data_concat, idat_data_concat_size);
-            RPNG_FREE(idat_data_concat);
-
-            // Compute CRC32 for security
-            unsigned char *chunk_type_data = (unsigned char *)RPNG_CALLOC(4 + chunk.length, 1);
-            memcpy(chunk_type_data, chunk.type, 4);
-            memcpy(chunk_type_data + 4, chunk.data, chunk.length);
-            chunk.crc = compute_crc32(chunk_type_data, 4 + chunk.length);
-            RPNG_FREE(chunk_type_data);
+            // CRC32 computed over type + all data concatenated
+            chunk.crc = crc;
         }
         else // Only one chunk required, not IDAT type
         {
-            while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
-            {
-                if (memcmp(buffer_ptr + 4, chunk_type, 4) == 0)
-                {
-                    chunk.length = chunk_size;
-                    memcpy(chunk.type, (char *)(buffer_ptr + 4), 4);
-                    chunk.data = (char *)RPNG_MALLOC(chunk_size);
-                    memcpy(chunk.data, buffer_ptr + 8, chunk_size);
-                    chunk.crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+            rpng_chunk view = rpng_chunk_view(index, position);
 
-                    break;
-                }
+            if (!rpng_chunk_index_check_crc(index, position)) RPNG_LOG("WARNING: CRC not valid, %.4s chunk data could be corrupted\n", view.type);
 
-                buffer_ptr += (4 + 4 + chunk_size + 4); // Move pointer to next chunk of input data
-                chunk_size = swap_endian(((int *)buffer_ptr)[0]); // Compute next chunk file_size
-            }
+            chunk.length = view.length;
+            memcpy(chunk.type, view.type, 4);
+            chunk.data = (char *)RPNG_MALLOC((view.length > 0)? view.length : 1);
+            memcpy(chunk.data, view.data, view.length);
+            chunk.crc = view.crc;
         }
     }
 
+    rpng_chunk_index_unload(index);
+
     return chunk;
 }
 
 // Read all chunks from memory buffer
-rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int *count)
+// NOTE: Returned chunks data is a copy, it must be freed by user
+rpng_chunk *rpng_chunk_read_all_from_memory(const char *buffer, int size, int *count)
 {
-    char *buffer_ptr = (char *)buffer;
     rpng_chunk *chunks = NULL;
-    int counter = 0;
 
-    // NOTE: We check minimum file_size for a PNG (Signature + chunk IHDR + chunk IDAT + chunk IEND)
-    if ((buffer_ptr != NULL) && (memcmp(buffer_ptr, png_signature, 8) == 0))  // Check valid PNG file signature
-    {
-        // We allocate enough space for 64 chunks
-        chunks = (rpng_chunk *)RPNG_CALLOC(RPNG_MAX_CHUNKS_COUNT, sizeof(rpng_chunk));
-        buffer_ptr += 8; // Move pointer after signature
+    rpng_chunk_index index = rpng_chunk_index_from_memory(buffer, size);
 
-        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+    if (index.count > 0)
+    {
+        chunks = (rpng_chunk *)RPNG_CALLOC(index.count, sizeof(rpng_chunk));
 
-        while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+        for (int i = 0; i < index.count; i++)
         {
-            chunks[counter].length = chunk_size;
-            memcpy(chunks[counter].type, (char *)(buffer_ptr + 4), 4);
-            chunks[counter].data = (char *)RPNG_MALLOC(chunk_size);
-            memcpy(chunks[counter].data, buffer_ptr + 8, chunk_size);
-            chunks[counter].crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
+            rpng_chunk view = rpng_chunk_view(index, i);
 
-            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            chunks[i].length = view.length;
+            memcpy(chunks[i].type, view.type, 4);
+            chunks[i].data = (char *)RPNG_MALLOC((view.length > 0)? view.length : 1);
+            memcpy(chunks[i].data, view.data, view.length);
+            chunks[i].crc = view.crc;
+        }
+    }
+
+    *count = index.count;
+    rpng_chunk_index_unload(index);
+
+    return chunks;
+}
+
+// Scan all chunks from memory buffer, generating chunks index
+// NOTE: Data is walked only once, chunks data is not copied and CRC is not computed,
+// it can be validated for the chunks actually used with rpng_chunk_index_check_crc()
+// WARNING: Scan stops on first chunk exceeding buffer size (truncated data), index could be incomplete
+rpng_chunk_index rpng_chunk_index_from_memory(const char *buffer, int size)
+{
+    rpng_chunk_index index = { 0 };
+
+    if ((buffer != NULL) && (size >= 8) && (memcmp(buffer, png_signature, 8) == 0))  // Check valid PNG file
+    {
+        int capacity = 16;
+        index.buffer = buffer;
+        index.size = size;
+        index.chunks = (rpng_chunk_info *)RPNG_CALLOC(capacity, sizeof(rpng_chunk_info));
+
+        int offset = 8;   // Move offset after signature
+        bool iend_found = false;
+
+        while (!iend_found && (index.chunks != NULL))
+        {
+            if (index.count >= capacity)
+            {
+                capacity *= 2;
+                rpng_chunk_info *chunks_resized = (rpng_chunk_info *)RPNG_REALLOC(index.chunks, capacity*sizeof(rpng_chunk_info));
+                if (chunks_resized == NULL) break;
+                index.chunks = chunks_resized;
+            }
+
+            // Check chunk header and CRC fit on buffer: Length + FOURCC + CRC32
+            if ((offset + 12) > size)
+            {
+                RPNG_LOG("WARNING: PNG data truncated, chunks index could be incomplete\n");
+                break;
+            }
+
+            const unsigned char *buffer_ptr = (const unsigned char *)buffer + offset;
+            rpng_chunk_info *info = &index.chunks[index.count];
+            unsigned int value = 0;
+
+            memcpy(&value, buffer_ptr, 4);
+            info->length = (int)swap_endian(value);
+            memcpy(info->type, buffer_ptr + 4, 4);
+
+            if ((info->length < 0) || (info->length > (size - offset - 12)))
+            {
+                RPNG_LOG("WARNING: PNG chunk length not valid, chunks index could be incomplete\n");
+                break;
+            }
+
+            info->offset = offset + 4 + 4;
+            memcpy(&value, buffer_ptr + 4 + 4 + info->length, 4);
+            info->crc = swap_endian(value);
 
-            counter++;
-            if (counter >= (RPNG_MAX_CHUNKS_COUNT - 2)) break;   // WARNING: Too many chunks!
+            iend_found = (memcmp(info->type, "IEND", 4) == 0);
+            offset += (4 + 4 + info->length + 4);    // Length + FOURCC + chunk data + CRC32
+            index.count++;
         }
+    }
+
+    return index;
+}
 
-        // Read final IEND chunk
-        chunks[counter].length = chunk_size;
-        memcpy(chunks[counter].type, (char *)(buffer_ptr + 4), 4);
-        chunks[counter].data = (char *)RPNG_MALLOC(chunk_size);
-        memcpy(chunks[counter].data, buffer_ptr + 8, chunk_size);
-        chunks[counter].crc = swap_endian(((unsigned int *)(buffer_ptr + 8 + chunk_size))[0]);
-        counter++;
+// Unload chunks index
+// NOTE: Indexed data is not owned by index, it is not freed
+void rpng_chunk_index_unload(rpng_chunk_index index)
+{
+    RPNG_FREE(index.chunks);
+}
 
-        // Reallocate chunks file_size
-        rpng_chunk *chunks_resized = (rpng_chunk*)RPNG_REALLOC(chunks, counter*sizeof(rpng_chunk));
-        if (chunks_resized != NULL) chunks = chunks_resized;
+// Find chunk type on chunks index, starting from provided position
+// NOTE: Returns chunk position on index or -1 if not found
+int rpng_chunk_index_find(rpng_chunk_index index, const char *chunk_type, int start)
+{
+    if (start < 0) start = 0;
+
+    for (int i = start; i < index.count; i++)
+    {
+        if (memcmp(index.chunks[i].type, chunk_type, 4) == 0) return i;
     }
 
-    *count = counter;
-    return chunks;
+    return -1;
+}
+
+// Get chunk view from chunks index
+// WARNING: Chunk data points to indexed data (zero-copy), it must not be freed or modified
+rpng_chunk rpng_chunk_view(rpng_chunk_index index, int position)
+{
+    rpng_chunk chunk = { 0 };
+
+    if ((position >= 0) && (position < index.count))
+    {
+        chunk.length = index.chunks[position].length;
+        memcpy(chunk.type, index.chunks[position].type, 4);
+        chunk.data = (char *)index.buffer + index.chunks[position].offset;
+        chunk.crc = index.chunks[position].crc;
+    }
+
+    return chunk;
+}
+
+// Check indexed chunk CRC is valid, CRC computed over chunk type + data
+bool rpng_chunk_index_check_crc(rpng_chunk_index index, int position)
+{
+    if ((position < 0) || (position >= index.count)) return false;
+
+    const rpng_chunk_info *info = &index.chunks[position];
+
+    return (compute_crc32((unsigned char *)index.buffer + info->offset - 4, 4 + info->length) == info->crc);
 }
 
 // Remove one chunk type from memory buffer
@@ -1955,53 +2177,494 @@ char *rpng_chunk_split_image_data_from_memory(char *buffer, int split_size, int
                     crc = swap_endian(crc);
                     memcpy(idata_split_buffer + 4 + 4 + split_size, &crc, 4);
 
-                    chunk_remain_size -= split_size;
-                    buffer_ptr_offset += split_size;
+                    chunk_remain_size -= split_size;
+                    buffer_ptr_offset += split_size;
+
+                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
+                    output_buffer_size += (split_size + 12);
+                }
+
+                // Save last IDAT chunk piece
+                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
+                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
+                memcpy(idata_split_buffer + 4, "IDAT", 4);
+                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
+                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
+                crc = swap_endian(crc);
+                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+
+                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
+                output_buffer_size += (chunk_remain_size + 12);
+            }
+            else
+            {
+                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
+                output_buffer_size += (4 + 4 + chunk_size + 4);
+            }
+
+            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        }
+
+        RPNG_FREE(idata_split_buffer);
+
+        // Write IEND chunk
+        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
+        output_buffer_size += 12;
+
+        // Resize output buffer
+        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
+        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+    }
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Begin chunks edit transaction over a PNG memory buffer
+// WARNING: Provided buffer is not copied, it must be valid until edit is committed or discarded
+rpng_chunk_edit *rpng_chunk_edit_begin_from_memory(const char *buffer)
+{
+    rpng_chunk_edit *edit = NULL;
+
+    if ((buffer != NULL) && (memcmp(buffer, png_signature, 8) == 0))  // Check valid PNG file
+    {
+        edit = (rpng_chunk_edit *)RPNG_CALLOC(1, sizeof(rpng_chunk_edit));
+        if (edit != NULL) edit->buffer = buffer;
+    }
+    else RPNG_LOG("WARNING: PNG data for chunks edit is not valid\n");
+
+    return edit;
+}
+
+// Queue one new chunk to be added after IHDR (any kind)
+// NOTE: Chunk data is copied, CRC is computed on commit, chunks are added in queue order
+void rpng_chunk_edit_add(rpng_chunk_edit *edit, rpng_chunk chunk)
+{
+    if ((edit == NULL) || (chunk.length < 0) || ((chunk.length > 0) && (chunk.data == NULL))) return;
+
+    if (edit->add_count < RPNG_MAX_CHUNKS_COUNT)
+    {
+        rpng_chunk *added = &edit->add[edit->add_count];
+
+        added->length = chunk.length;
+        memcpy(added->type, chunk.type, 4);
+        added->data = (char *)RPNG_MALLOC((chunk.length > 0)? chunk.length : 1);
+        if (chunk.length > 0) memcpy(added->data, chunk.data, chunk.length);
+        added->crc = 0;
+
+        edit->add_count++;
+    }
+    else RPNG_LOG("WARNING: Too many chunks queued for edit\n");
+}
+
+// Queue tEXt chunk to be added
+void rpng_chunk_edit_add_text(rpng_chunk_edit *edit, char *keyword, char *text)
+{
+    rpng_chunk chunk = rpng_chunk_gen_text(keyword, text);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue zTXt chunk to be added, DEFLATE compressed text
+void rpng_chunk_edit_add_comp_text(rpng_chunk_edit *edit, char *keyword, char *text)
+{
+    rpng_chunk chunk = rpng_chunk_gen_comp_text(keyword, text);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue gAMA chunk to be added
+void rpng_chunk_edit_add_gamma(rpng_chunk_edit *edit, float gamma)
+{
+    rpng_chunk chunk = rpng_chunk_gen_gamma(gamma);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue sRGB chunk to be added
+void rpng_chunk_edit_add_srgb(rpng_chunk_edit *edit, char srgb_type)
+{
+    rpng_chunk chunk = rpng_chunk_gen_srgb(srgb_type);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue tIME chunk to be added
+void rpng_chunk_edit_add_time(rpng_chunk_edit *edit, short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk chunk = rpng_chunk_gen_time(year, month, day, hour, min, sec);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue pHYs chunk to be added
+void rpng_chunk_edit_add_physical_size(rpng_chunk_edit *edit, int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk chunk = rpng_chunk_gen_physical_size(pixels_unit_x, pixels_unit_y, meters);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue cHRM chunk to be added
+void rpng_chunk_edit_add_chroma(rpng_chunk_edit *edit, float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+{
+    rpng_chunk chunk = rpng_chunk_gen_chroma(white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y);
+    rpng_chunk_edit_add(edit, chunk);
+    RPNG_FREE(chunk.data);
+}
+
+// Queue all chunks of one type to be removed from source data
+// NOTE: Critical chunks (IHDR, PLTE, IDAT, IEND) can not be removed,
+// chunks queued for addition on the same edit are not affected
+void rpng_chunk_edit_remove(rpng_chunk_edit *edit, const char *chunk_type)
+{
+    if ((edit == NULL) || (chunk_type == NULL)) return;
+
+    if ((memcmp(chunk_type, "IHDR", 4) == 0) ||
+        (memcmp(chunk_type, "PLTE", 4) == 0) ||
+        (memcmp(chunk_type, "IDAT", 4) == 0) ||
+        (memcmp(chunk_type, "IEND", 4) == 0))
+    {
+        RPNG_LOG("WARNING: Critical chunk can not be removed: %c%c%c%c\n", chunk_type[0], chunk_type[1], chunk_type[2], chunk_type[3]);
+    }
+    else if (rpng_chunk_edit_removes(edit, chunk_type)) return;    // Already queued
+    else if (edit->remove_count < RPNG_MAX_CHUNKS_COUNT)
+    {
+        memcpy(edit->remove[edit->remove_count], chunk_type, 4);
+        edit->remove_count++;
+    }
+    else RPNG_LOG("WARNING: Too many chunk types queued for removal\n");
+}
+
+// Commit chunks edit transaction to memory buffer
+// NOTE: Source chunks headers are scanned to compute the exact output size,
+// output is allocated once and every chunk is copied only once, edit is released
+char *rpng_chunk_edit_commit_to_memory(rpng_chunk_edit *edit, int *output_size)
+{
+    char *output_buffer = NULL;
+    int output_buffer_size = 0;
+
+    if (edit != NULL)
+    {
+        // Compute exact output size: signature + preserved chunks + added chunks
+        const char *buffer_ptr = edit->buffer + 8;
+        int required_size = 8;
+        bool ihdr_found = false;
+
+        unsigned int chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+
+        while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+        {
+            if (memcmp(buffer_ptr + 4, "IHDR", 4) == 0) ihdr_found = true;
+            if (!rpng_chunk_edit_removes(edit, buffer_ptr + 4)) required_size += (4 + 4 + chunk_size + 4);
+
+            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+        }
+
+        required_size += 12;    // IEND chunk
+
+        for (int i = 0; i < edit->add_count; i++) required_size += (4 + 4 + edit->add[i].length + 4);
+
+        if (ihdr_found) output_buffer = (char *)RPNG_MALLOC(required_size);
+        else RPNG_LOG("WARNING: PNG data for chunks edit does not contain IHDR chunk\n");
+
+        if (output_buffer != NULL)
+        {
+            memcpy(output_buffer, png_signature, 8);        // Copy PNG signature
+            output_buffer_size += 8;
+
+            buffer_ptr = edit->buffer + 8;
+            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+
+            while (memcmp(buffer_ptr + 4, "IEND", 4) != 0) // While IEND chunk not reached
+            {
+                if (!rpng_chunk_edit_removes(edit, buffer_ptr + 4))
+                {
+                    memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
+                    output_buffer_size += (4 + 4 + chunk_size + 4);
+                }
+
+                // Queued chunks are added just after IHDR chunk
+                if (memcmp(buffer_ptr + 4, "IHDR", 4) == 0)
+                {
+                    for (int i = 0; i < edit->add_count; i++)
+                    {
+                        rpng_chunk *chunk = &edit->add[i];
+                        unsigned char *chunk_ptr = (unsigned char *)output_buffer + output_buffer_size;
+
+                        int chunk_length_be = swap_endian(chunk->length);
+                        memcpy(chunk_ptr, &chunk_length_be, 4);                 // Write chunk length
+                        memcpy(chunk_ptr + 4, chunk->type, 4);                  // Write chunk type
+                        memcpy(chunk_ptr + 4 + 4, chunk->data, chunk->length);  // Write chunk data
+
+                        // NOTE: CRC is computed over type + data, already placed on output
+                        unsigned int crc = swap_endian(compute_crc32(chunk_ptr + 4, 4 + chunk->length));
+                        memcpy(chunk_ptr + 4 + 4 + chunk->length, &crc, 4);     // Write CRC32
+
+                        output_buffer_size += (4 + 4 + chunk->length + 4);
+                    }
+                }
+
+                buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
+                chunk_size = swap_endian(((int *)buffer_ptr)[0]);
+            }
+
+            // Write IEND chunk
+            memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
+            output_buffer_size += 12;
+
+            RPNG_LOG("INFO: PNG chunks edit committed: %i added, %i types removed, %i bytes\n", edit->add_count, edit->remove_count, output_buffer_size);
+        }
+    }
+
+    rpng_chunk_edit_discard(edit);
+
+    *output_size = output_buffer_size;
+    return output_buffer;
+}
+
+// Discard chunks edit transaction, queued changes are not applied
+void rpng_chunk_edit_discard(rpng_chunk_edit *edit)
+{
+    if (edit == NULL) return;
+
+    for (int i = 0; i < edit->add_count; i++) RPNG_FREE(edit->add[i].data);
+    if (edit->buffer_owned) unload_file_buffer((char *)edit->buffer, edit->buffer_size, edit->buffer_mode);
+
+    RPNG_FREE(edit);
+}
+
+// Set built-in file I/O backend, custom callbacks are reset
+// NOTE: Memory-mapped reading and atomic writing fallback to stdio if not available
+void rpng_set_file_io(int read_mode, int write_mode)
+{
+    file_read_mode = read_mode;
+    file_write_mode = write_mode;
+
+    load_file_callback = NULL;
+    unload_file_callback = NULL;
+    save_file_callback = NULL;
+}
+
+// Set custom file I/O callbacks, NULL callbacks use built-in backend
+// NOTE: Unload callback must be provided along with load callback,
+// if not provided, loaded data is released with RPNG_FREE()
+void rpng_set_file_callbacks(rpng_load_file_callback load, rpng_unload_file_callback unload, rpng_save_file_callback save)
+{
+    load_file_callback = load;
+    unload_file_callback = unload;
+    save_file_callback = save;
+}
+
+// Set deflate state cache, state is kept allocated between compressions
+// NOTE: Useful for many consecutive compressions (i.e. batch conversions),
+// deflate state does not require clearing between uses (hash table reset on every compression)
+void rpng_set_deflate_state_cache(bool enabled)
+{
+    deflate_state_cache = enabled;
+
+    if (!enabled && (deflate_state != NULL))
+    {
+        RPNG_FREE(deflate_state);
+        deflate_state = NULL;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get image data from indexed IDAT chunks, all consecutive IDAT chunks are joined
+// NOTE: In case of a single IDAT chunk, data points to indexed data (not copied) if followed by
+// enough bytes (CRC + IEND), joined data includes some padding bytes, inflate can read some bytes ahead of data end
+static const char *rpng_chunk_index_image_data(rpng_chunk_index index, int *size, bool *copied)
+{
+    const char *image_data = NULL;
+    int idat_count = 0;
+    int idat_size = 0;
+
+    *size = 0;
+    *copied = false;
+
+    int first = rpng_chunk_index_find(index, "IDAT", 0);
+
+    for (int i = first; (i >= 0) && (i < index.count) && (memcmp(index.chunks[i].type, "IDAT", 4) == 0); i++)
+    {
+        if (!rpng_chunk_index_check_crc(index, i))
+        {
+            RPNG_LOG("WARNING: CRC not valid, IDAT chunk image data could be corrupted\n");
+            return NULL;
+        }
+
+        idat_size += index.chunks[i].length;
+        idat_count++;
+    }
+
+    if ((idat_count == 1) && ((index.chunks[first].offset + idat_size + 16) <= index.size)) image_data = index.buffer + index.chunks[first].offset;
+    else if (idat_count > 0)
+    {
+        char *idat_data_concat = (char *)RPNG_CALLOC(idat_size + 16, 1);
+
+        if (idat_data_concat != NULL)
+        {
+            for (int i = first, offset = 0; i < (first + idat_count); i++)
+            {
+                memcpy(idat_data_concat + offset, index.buffer + index.chunks[i].offset, index.chunks[i].length);
+                offset += index.chunks[i].length;
+            }
+
+            image_data = idat_data_concat;
+            *copied = true;
+        }
+    }
+
+    if (image_data != NULL) *size = idat_size;
+
+    return image_data;
+}
+// Check if chunk type is queued for removal on chunks edit
+static bool rpng_chunk_edit_removes(const rpng_chunk_edit *edit, const char *chunk_type)
+{
+    for (int i = 0; i < edit->remove_count; i++)
+    {
+        if (memcmp(edit->remove[i], chunk_type, 4) == 0) return true;
+    }
+
+    return false;
+}
+
+// Generate tEXt chunk, keyword and text separated by NULL
+// NOTE: CRC is left to 0, it's calculated internally on writing
+static rpng_chunk rpng_chunk_gen_text(const char *keyword, const char *text)
+{
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    memcpy(chunk.type, "tEXt", 4);
+    chunk.length = keyword_len + 1 + text_len;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 1, text, text_len);
+
+    return chunk;
+}
+
+// Generate zTXt chunk, DEFLATE compressed text
+static rpng_chunk rpng_chunk_gen_comp_text(const char *keyword, const char *text)
+{
+    rpng_chunk chunk = { 0 };
+
+    int keyword_len = (int)strlen(keyword);
+    int text_len = (int)strlen(text);
+
+    // Compress text data and generate a valid zlib stream
+    struct sdefl *sde = rpng_deflate_state_acquire();
+    int bounds = sdefl_bound(text_len);
+    unsigned char *comp_text = (unsigned char *)RPNG_CALLOC(bounds, 1);
+    int comp_text_size = zsdeflate(sde, comp_text, (unsigned char *)text, text_len, RPNG_COMPRESSION_LEVEL);
+    rpng_deflate_state_release(sde);
+
+    memcpy(chunk.type, "zTXt", 4);
+    chunk.length = keyword_len + 1 + 1 + comp_text_size;   // Keyword + NULL separator + compression method (0)
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, keyword, keyword_len);
+    memcpy(chunk.data + keyword_len + 2, comp_text, comp_text_size);
+    RPNG_FREE(comp_text);
+
+    return chunk;
+}
+
+// Generate gAMA chunk, gamma stored as one int: gamma*100000
+static rpng_chunk rpng_chunk_gen_gamma(float gamma)
+{
+    rpng_chunk chunk = { 0 };
+
+    int gamma_value = swap_endian((int)(gamma*100000));
+
+    memcpy(chunk.type, "gAMA", 4);
+    chunk.length = 4;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    memcpy(chunk.data, &gamma_value, 4);
+
+    return chunk;
+}
+
+// Generate sRGB chunk, 1 byte defining rendering intent
+static rpng_chunk rpng_chunk_gen_srgb(char srgb_type)
+{
+    rpng_chunk chunk = { 0 };
+
+    if ((srgb_type < 0) || (srgb_type > 3)) srgb_type = 0;
+
+    memcpy(chunk.type, "sRGB", 4);
+    chunk.length = 1;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    chunk.data[0] = srgb_type;
+
+    return chunk;
+}
+
+// Generate tIME chunk
+// NOTE: Year is stored as big-endian 2 bytes value
+static rpng_chunk rpng_chunk_gen_time(short year, char month, char day, char hour, char min, char sec)
+{
+    rpng_chunk chunk = { 0 };
+
+    memcpy(chunk.type, "tIME", 4);
+    chunk.length = 7;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    chunk.data[0] = (char)((year >> 8) & 0xff);
+    chunk.data[1] = (char)(year & 0xff);
+    chunk.data[2] = month;
+    chunk.data[3] = day;
+    chunk.data[4] = hour;
+    chunk.data[5] = min;
+    chunk.data[6] = sec;
+
+    return chunk;
+}
 
-                    memcpy(output_buffer + output_buffer_size, idata_split_buffer, split_size + 12);
-                    output_buffer_size += (split_size + 12);
-                }
+// Generate pHYs chunk
+static rpng_chunk rpng_chunk_gen_physical_size(int pixels_unit_x, int pixels_unit_y, bool meters)
+{
+    rpng_chunk chunk = { 0 };
 
-                // Save last IDAT chunk piece
-                unsigned int chunk_remain_size_be = swap_endian(chunk_remain_size);
-                memcpy(idata_split_buffer, &chunk_remain_size_be, 4);
-                memcpy(idata_split_buffer + 4, "IDAT", 4);
-                memcpy(idata_split_buffer + 4 + 4, buffer_ptr_offset, chunk_remain_size);
-                unsigned int crc = compute_crc32((unsigned char *)(idata_split_buffer + 4), 4 + chunk_remain_size);
-                crc = swap_endian(crc);
-                memcpy(idata_split_buffer + 4 + 4 + chunk_remain_size, &crc, 4);
+    memcpy(chunk.type, "pHYs", 4);
+    chunk.length = 9;
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
+    pixels_unit_x = swap_endian(pixels_unit_x);
+    memcpy(chunk.data, &pixels_unit_x, 4);
+    pixels_unit_y = swap_endian(pixels_unit_y);
+    memcpy(chunk.data + 4, &pixels_unit_y, 4);
+    chunk.data[8] = (meters)? 1 : 0;
 
-                memcpy(output_buffer + output_buffer_size, idata_split_buffer, chunk_remain_size + 12);
-                output_buffer_size += (chunk_remain_size + 12);
-            }
-            else
-            {
-                memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + chunk_size + 4);  // Length + FOURCC + chunk_size + CRC32
-                output_buffer_size += (4 + 4 + chunk_size + 4);
-            }
+    return chunk;
+}
 
-            buffer_ptr += (4 + 4 + chunk_size + 4);   // Move pointer to next chunk
-            chunk_size = swap_endian(((int *)buffer_ptr)[0]);
-        }
+// Generate cHRM chunk, every value stored as one int: value*100000
+static rpng_chunk rpng_chunk_gen_chroma(float white_x, float white_y, float red_x, float red_y, float green_x, float green_y, float blue_x, float blue_y)
+{
+    rpng_chunk chunk = { 0 };
 
-        RPNG_FREE(idata_split_buffer);
+    float values[8] = { white_x, white_y, red_x, red_y, green_x, green_y, blue_x, blue_y };
 
-        // Write IEND chunk
-        memcpy(output_buffer + output_buffer_size, buffer_ptr, 4 + 4 + 4);
-        output_buffer_size += 12;
+    memcpy(chunk.type, "cHRM", 4);
+    chunk.length = 8*4;     // 8 integer values
+    chunk.data = (char *)RPNG_CALLOC(chunk.length, 1);
 
-        // Resize output buffer
-        char *output_buffer_sized = (char *)RPNG_REALLOC(output_buffer, output_buffer_size);
-        if (output_buffer_sized != NULL) output_buffer = output_buffer_sized;
+    for (int i = 0; i < 8; i++)
+    {
+        int value = swap_endian((int)(values[i]*100000));
+        memcpy(chunk.data + i*4, &value, 4);
     }
 
-    *output_size = output_buffer_size;
-    return output_buffer;
+    return chunk;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 
 // Prefilter and compress image data
 static char *rpng_deflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size, int *output_size, int forced_filter_type)
@@ -2095,13 +2758,24 @@ static char *rpng_deflate_image_data(const char *image_data, int image_data_size
         }
     }
 
-    // Compress filtered image data and generate a valid zlib stream
-    struct sdefl *sde = (struct sdefl*)RPNG_CALLOC(sizeof(struct sdefl), 1);
-    int bounds = sdefl_bound(data_filtered_size);
-    char *comp_data = (char *)RPNG_CALLOC(bounds, 1);
-    int comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, RPNG_COMPRESSION_LEVEL);
+    char *comp_data = NULL;
+    int comp_data_size = 0;
+
+#if defined(RPNG_DEFLATE_THREADS)
+    // Big images are compressed in independent segments on multiple threads
+    if (data_filtered_size >= 2*RPNG_DEFLATE_SEGMENT_SIZE) comp_data = rpng_deflate_parallel(data_filtered, data_filtered_size, scanline_size + 1, &comp_data_size);
+    else
+#endif
+    {
+        // Compress filtered image data and generate a valid zlib stream
+        struct sdefl *sde = rpng_deflate_state_acquire();
+        int bounds = sdefl_bound(data_filtered_size);
+        comp_data = (char *)RPNG_CALLOC(bounds, 1);
+        comp_data_size = zsdeflate(sde, comp_data, data_filtered, data_filtered_size, RPNG_COMPRESSION_LEVEL);
+        rpng_deflate_state_release(sde);
+    }
+
     RPNG_FREE(data_filtered);
-    RPNG_FREE(sde);
 
     if ((comp_data != NULL) && (comp_data_size > 0))
     {
@@ -2114,33 +2788,228 @@ static char *rpng_deflate_image_data(const char *image_data, int image_data_size
     return idat_data;
 }
 
+#if defined(RPNG_DEFLATE_THREADS)
+// Thread entry point for deflate worker
+#if defined(_WIN32) && defined(_MSC_VER)
+static unsigned __stdcall rpng_deflate_worker_thread(void *worker) { rpng_deflate_worker_process((rpng_deflate_worker *)worker); return 0; }
+#else
+static void *rpng_deflate_worker_thread(void *worker) { rpng_deflate_worker_process((rpng_deflate_worker *)worker); return NULL; }
+#endif
+
+// Compress filtered image data on multiple threads (pigz-style)
+// NOTE: Data is split in segments of full scanlines, every segment is compressed as raw deflate
+// using previous 32KB of data as dictionary and ending with a one byte stored block (byte aligned),
+// so all segments can be concatenated into a single zlib stream with a combined Adler-32
+static char *rpng_deflate_parallel(const unsigned char *data, int data_size, int scanline_size, int *output_size)
+{
+    char *comp_data = NULL;
+    *output_size = 0;
+
+    int segment_size = (RPNG_DEFLATE_SEGMENT_SIZE/scanline_size)*scanline_size;
+    if (segment_size == 0) segment_size = scanline_size;
+    int segment_count = (data_size + segment_size - 1)/segment_size;
+
+    rpng_deflate_segment *segments = (rpng_deflate_segment *)RPNG_CALLOC(segment_count, sizeof(rpng_deflate_segment));
+
+    for (int i = 0; i < segment_count; i++)
+    {
+        segments[i].data = data + i*segment_size;
+        segments[i].dict_size = (i*segment_size < 32*1024)? i*segment_size : 32*1024;
+        segments[i].size = (i == (segment_count - 1))? (data_size - i*segment_size) : segment_size;
+        segments[i].last = (i == (segment_count - 1));
+    }
+
+    int worker_count = (segment_count < RPNG_DEFLATE_THREADS)? segment_count : RPNG_DEFLATE_THREADS;
+    if (worker_count < 1) worker_count = 1;
+
+    rpng_deflate_worker *workers = (rpng_deflate_worker *)RPNG_CALLOC(worker_count, sizeof(rpng_deflate_worker));
+#if defined(_WIN32) && defined(_MSC_VER)
+    void **threads = (void **)RPNG_CALLOC(worker_count, sizeof(void *));
+#else
+    pthread_t *threads = (pthread_t *)RPNG_CALLOC(worker_count, sizeof(pthread_t));
+#endif
+    bool *threads_running = (bool *)RPNG_CALLOC(worker_count, sizeof(bool));
+
+    for (int i = 0; i < worker_count; i++)
+    {
+        workers[i].segments = segments;
+        workers[i].segment_count = segment_count;
+        workers[i].first = i;
+        workers[i].stride = worker_count;
+    }
+
+    // Launch additional workers, calling thread processes first worker segments
+    // NOTE: In case a thread can not be created, its segments are processed by calling thread
+    for (int i = 1; i < worker_count; i++)
+    {
+#if defined(_WIN32) && defined(_MSC_VER)
+        threads[i] = (void *)_beginthreadex(NULL, 0, rpng_deflate_worker_thread, &workers[i], 0, NULL);
+        threads_running[i] = (threads[i] != NULL);
+#else
+        threads_running[i] = (pthread_create(&threads[i], NULL, rpng_deflate_worker_thread, &workers[i]) == 0);
+#endif
+    }
+
+    rpng_deflate_worker_process(&workers[0]);
+
+    for (int i = 1; i < worker_count; i++)
+    {
+        if (threads_running[i])
+        {
+#if defined(_WIN32) && defined(_MSC_VER)
+            WaitForSingleObject(threads[i], 0xFFFFFFFF);    // INFINITE
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+        else rpng_deflate_worker_process(&workers[i]);
+    }
+
+    // Join compressed segments into a zlib stream: header + segments + Adler-32
+    bool segments_valid = true;
+    int comp_data_size = 2 + 4;
+    for (int i = 0; i < segment_count; i++)
+    {
+        if (segments[i].comp_data == NULL) segments_valid = false;
+        comp_data_size += segments[i].comp_size;
+    }
+
+    if (segments_valid)
+    {
+        comp_data = (char *)RPNG_MALLOC(comp_data_size);
+
+        unsigned int adler = 1;
+        int offset = 0;
+
+        comp_data[0] = 0x78;    // Deflate, 32K window
+        comp_data[1] = 0x01;    // Fast compression
+        offset += 2;
+
+        for (int i = 0; i < segment_count; i++)
+        {
+            memcpy(comp_data + offset, segments[i].comp_data, segments[i].comp_size);
+            offset += segments[i].comp_size;
+
+            adler = rpng_adler32_combine(adler, segments[i].adler, segments[i].size);
+        }
+
+        comp_data[offset + 0] = (char)((adler >> 24) & 0xff);   // Adler-32 stored big-endian
+        comp_data[offset + 1] = (char)((adler >> 16) & 0xff);
+        comp_data[offset + 2] = (char)((adler >> 8) & 0xff);
+        comp_data[offset + 3] = (char)(adler & 0xff);
+
+        *output_size = comp_data_size;
+        RPNG_LOG("INFO: Image data deflated on %i threads (%i segments)\n", worker_count, segment_count);
+    }
+
+    for (int i = 0; i < segment_count; i++) RPNG_FREE(segments[i].comp_data);
+    RPNG_FREE(threads_running);
+    RPNG_FREE(threads);
+    RPNG_FREE(workers);
+    RPNG_FREE(segments);
+
+    return comp_data;
+}
+
+// Compress worker assigned segments, one deflate state per worker
+static void rpng_deflate_worker_process(rpng_deflate_worker *worker)
+{
+    struct sdefl *sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+    if (sde == NULL) return;
+
+    for (int i = worker->first; i < worker->segment_count; i += worker->stride)
+    {
+        rpng_deflate_segment *segment = &worker->segments[i];
+
+        // NOTE: Extra space required for final one byte stored block
+        segment->comp_data = (unsigned char *)RPNG_CALLOC(sdefl_bound(segment->size) + 8, 1);
+
+        if (segment->comp_data != NULL)
+        {
+            segment->comp_size = sdeflate_segment(sde, segment->comp_data, segment->data - segment->dict_size,
+                segment->dict_size, segment->size, RPNG_COMPRESSION_LEVEL, segment->last);
+            segment->adler = sdefl_adler(1, segment->data, segment->size);
+        }
+    }
+
+    RPNG_FREE(sde);
+}
+
+// Combine Adler-32 checksums of two consecutive data blocks
+// NOTE: Checksum of second block is combined considering its size (same as zlib adler32_combine())
+static unsigned int rpng_adler32_combine(unsigned int adler1, unsigned int adler2, int size2)
+{
+    const unsigned int base = 65521;    // Largest prime smaller than 65536
+
+    unsigned int rem = (unsigned int)(size2%base);
+    unsigned int sum1 = adler1 & 0xffff;
+    unsigned int sum2 = (rem*sum1)%base;
+
+    sum1 += (adler2 & 0xffff) + base - 1;
+    sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + base - rem;
+
+    if (sum1 >= base) sum1 -= base;
+    if (sum1 >= base) sum1 -= base;
+    if (sum2 >= (base << 1)) sum2 -= (base << 1);
+    if (sum2 >= base) sum2 -= base;
+
+    return (sum2 << 16) | sum1;
+}
+#endif  // RPNG_DEFLATE_THREADS
+
+// Get deflate state for one compression, cached state returned if available
+static struct sdefl *rpng_deflate_state_acquire(void)
+{
+    struct sdefl *sde = NULL;
+
+    if (deflate_state_cache && (deflate_state != NULL))
+    {
+        sde = deflate_state;
+        deflate_state = NULL;   // State in use, not available for nested compressions
+    }
+    else sde = (struct sdefl *)RPNG_CALLOC(sizeof(struct sdefl), 1);
+
+    return sde;
+}
+
+// Release deflate state after compression, kept for next compression if cache enabled
+static void rpng_deflate_state_release(struct sdefl *sde)
+{
+    if (deflate_state_cache && (deflate_state == NULL)) deflate_state = sde;
+    else RPNG_FREE(sde);
+}
+
 // Decompress and unfilter image data (IDAT)
-static char *rpng_inflate_image_data(char *image_data, int image_data_size, int width, int height, int pixel_size)
+// NOTE: Decompressed data size is known in advance: (1 + scanline_size)*height
+static char *rpng_inflate_image_data(const char *image_data, int image_data_size, int width, int height, int pixel_size)
 {
     char *image_data_unfiltered = NULL;
-    char *image_data_filtered = (char *)RPNG_CALLOC(RPNG_MAX_OUTPUT_SIZE, 1); // WARNING: Allocate enough memory to load full image decompressed
+
+    int scanline_size = width*pixel_size;
+    int image_data_filtered_size = (1 + scanline_size)*height;     // Adding 1 byte per scanline filter
+    unsigned char *image_data_filtered = (unsigned char *)RPNG_MALLOC(image_data_filtered_size);
 
     // Decompress IDAT chunk data
-    int image_data_decomp_size = zsinflate(image_data_filtered, RPNG_MAX_OUTPUT_SIZE, image_data, image_data_size);
+    int image_data_decomp_size = 0;
+    if (image_data_filtered != NULL) image_data_decomp_size = zsinflate(image_data_filtered, image_data_filtered_size, image_data, image_data_size);
 
     RPNG_LOG("INFO: IDAT data decompressed: %i -> %i\n", image_data_size, image_data_decomp_size);
 
-    if ((image_data_filtered != NULL) && (image_data_decomp_size > 0))
+    if ((image_data_filtered != NULL) && (image_data_decomp_size == image_data_filtered_size))
     {
         // Now we have the data decompressed but every scanline of the image was originally filtered for
         // maximum compression and one extra byte with the filter type was added to every scanline
         // We must undo that image prefiltering for every scanline
 
         // Image data reverse pre-processing for filter type
-        //int pixel_size = *color_channels*(*bit_depth/8);
-        int scanline_size = width*pixel_size;
-        image_data_unfiltered = (char *)RPNG_CALLOC(image_data_decomp_size, 1);  // Actually data unfiltered size should be smaller
+        unsigned char *unfiltered = (unsigned char *)RPNG_CALLOC(scanline_size*height, 1);
 
         int current_filter = 0;
         int out = 0, x = 0, a = 0, b = 0, c = 0;
 
         // Reverse scanlines filters
-        for (int y = 0; y < height; y++)   // Move scanline by scanline, we must discard first byte = current_filter
+        for (int y = 0; (unfiltered != NULL) && (y < height); y++)   // Move scanline by scanline, we must discard first byte = current_filter
         {
             current_filter = (int)image_data_filtered[(1 + scanline_size)*y];
 
@@ -2150,10 +3019,11 @@ static char *rpng_inflate_image_data(char *image_data, int image_data_size, int
                 // a = left pixel byte (from current)
                 // b = above pixel byte (from current)
                 // c = left pixel byte (from b)
+                // NOTE: Bytes must be read unsigned for Average and Paeth filters
                 x = (int)(image_data_filtered[(1 + scanline_size)*y + 1 + p]);
-                a = (p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*y + p - pixel_size]) : 0;
-                b = (y > 0) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p]) : 0;
-                c = (y > 0) ? ((p >= pixel_size) ? (int)(image_data_unfiltered[scanline_size*(y - 1) + p - pixel_size]) : 0) : 0;
+                a = (p >= pixel_size) ? (int)(unfiltered[scanline_size*y + p - pixel_size]) : 0;
+                b = (y > 0) ? (int)(unfiltered[scanline_size*(y - 1) + p]) : 0;
+                c = (y > 0) ? ((p >= pixel_size) ? (int)(unfiltered[scanline_size*(y - 1) + p - pixel_size]) : 0) : 0;
 
                 switch (current_filter)
                 {
@@ -2166,13 +3036,15 @@ static char *rpng_inflate_image_data(char *image_data, int image_data_size, int
                 }
 
                 // Register scanline unfiltered values, byte by byte
-                image_data_unfiltered[y*scanline_size + p] = (char)out;
+                unfiltered[y*scanline_size + p] = (unsigned char)out;
             }
         }
 
-        RPNG_FREE(image_data_filtered);
+        image_data_unfiltered = (char *)unfiltered;
     }
 
+    RPNG_FREE(image_data_filtered);
+
     return image_data_unfiltered;
 }
 
@@ -2195,6 +3067,13 @@ static unsigned int swap_endian(unsigned int value)
 
 // Compute CRC32
 static unsigned int compute_crc32(unsigned char *buffer, int size)
+{
+    return update_crc32(0, buffer, size);
+}
+
+// Update CRC32 with more data, initial crc value must be 0
+// NOTE: It allows computing CRC32 of data not placed contiguously in memory
+static unsigned int update_crc32(unsigned int crc, const unsigned char *buffer, int size)
 {
     static unsigned int crc_table[256] = {
         0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
@@ -2231,7 +3110,7 @@ static unsigned int compute_crc32(unsigned char *buffer, int size)
         0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
     };
 
-    unsigned int crc = ~0u;
+    crc = ~crc;
 
     for (int i = 0; i < size; i++) crc = (crc >> 8) ^ crc_table[buffer[i] ^ (crc & 0xff)];
 
@@ -2239,15 +3118,72 @@ static unsigned int compute_crc32(unsigned char *buffer, int size)
 }
 
 // Load data from file into a buffer
-static char *load_file_to_buffer(const char *filename, int *bytes_read)
+// NOTE: File is opened once, on POSIX systems it is read from file descriptor
+// (size queried with fstat()) or memory-mapped (RPNG_FILE_READ_MMAP), the way the
+// buffer was loaded is returned in load_mode, read mode could change before unloading
+static char *load_file_to_buffer(const char *filename, int *bytes_read, int *load_mode)
 {
     char *data = NULL;
     *bytes_read = 0;
+    *load_mode = RPNG_FILE_READ_STDIO;
+
+    if (load_file_callback != NULL)
+    {
+        *load_mode = RPNG_FILE_READ_CALLBACK;
+        return (filename != NULL)? load_file_callback(filename, bytes_read) : NULL;
+    }
 
 #if !defined(RPNG_NO_STDIO)
-    // Check if the file exists before reading it
-    if ((filename != NULL) && file_exists(filename))
+    if (filename != NULL)
     {
+#if defined(RPNG_FILE_IO_POSIX)
+        int fd = open(filename, O_RDONLY);
+
+        if (fd != -1)
+        {
+            struct stat file_stat = { 0 };
+            int file_size = (fstat(fd, &file_stat) == 0)? (int)file_stat.st_size : 0;
+
+            if (file_size > 0)
+            {
+                if (file_read_mode == RPNG_FILE_READ_MMAP)
+                {
+                    // NOTE: Private writable mapping, pages are copied only if written
+                    void *map = mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+                    if (map != MAP_FAILED)
+                    {
+                        data = (char *)map;
+                        *bytes_read = file_size;
+                        *load_mode = RPNG_FILE_READ_MMAP;
+                        RPNG_LOG("FILEIO: [%s] File mapped successfully\n", filename);
+                    }
+                    else RPNG_LOG("FILEIO: [%s] Failed to map file\n", filename);
+                }
+                else
+                {
+                    data = (char *)RPNG_MALLOC(sizeof(unsigned char)*file_size);
+
+                    int count = 0;
+                    while (count < file_size)
+                    {
+                        int result = (int)read(fd, data + count, file_size - count);
+                        if (result <= 0) break;
+                        count += result;
+                    }
+
+                    *bytes_read = count;
+
+                    if (count != file_size) RPNG_LOG("FILEIO: [%s] File partially loaded\n", filename);
+                    else RPNG_LOG("FILEIO: [%s] File loaded successfully\n", filename);
+                }
+            }
+            else RPNG_LOG("FILEIO: [%s] Failed to read file\n", filename);
+
+            close(fd);
+        }
+        else RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+#else
         FILE *file = fopen(filename, "rb");
 
         if (file != NULL)
@@ -2274,6 +3210,7 @@ static char *load_file_to_buffer(const char *filename, int *bytes_read)
             fclose(file);
         }
         else RPNG_LOG("FILEIO: [%s] Failed to open file\n", filename);
+#endif
     }
     else RPNG_LOG("FILEIO: File path provided is not valid\n");
 #else
@@ -2285,13 +3222,119 @@ static char *load_file_to_buffer(const char *filename, int *bytes_read)
     return data;
 }
 
+// Unload data loaded with load_file_to_buffer(), load mode returned on loading required
+static void unload_file_buffer(char *data, int size, int load_mode)
+{
+    if (data == NULL) return;
+
+    if (load_mode == RPNG_FILE_READ_CALLBACK)
+    {
+        if (unload_file_callback != NULL) unload_file_callback(data, size);
+        else RPNG_FREE(data);
+        return;
+    }
+
+#if defined(RPNG_FILE_IO_POSIX)
+    if (load_mode == RPNG_FILE_READ_MMAP)
+    {
+        munmap(data, size);
+        return;
+    }
+#else
+    (void)size;
+#endif
+    RPNG_FREE(data);
+}
+
+#if defined(RPNG_FILE_IO_POSIX)
+// Write data to file descriptor, partial writes are retried
+static bool write_file_data(int fd, const char *data, int size)
+{
+    int count = 0;
+
+    while (count < size)
+    {
+        int result = (int)write(fd, data + count, size - count);
+        if (result <= 0) break;
+        count += result;
+    }
+
+    return (count == size);
+}
+
+// Write data to temporary file and rename it over destination file
+// NOTE: Destination file is replaced atomically, it is never seen partially written
+static int save_file_atomic(const char *filename, const char *data, int size)
+{
+    int result = RPNG_ERROR_FILE_OPEN;
+
+    int filename_len = (int)strlen(filename);
+    char *temp_filename = (char *)RPNG_CALLOC(filename_len + 16, 1);
+    snprintf(temp_filename, filename_len + 16, "%s.tmpXXXXXX", filename);
+
+    bool written = false;
+    int fd = mkstemp(temp_filename);
+
+    if (fd != -1)
+    {
+        // NOTE: mkstemp() creates file with 0600 permissions, replaced file permissions are kept,
+        // new file gets default ones (0666 masked by process umask, same as fopen())
+        struct stat file_stat = { 0 };
+        mode_t mode = 0;
+
+        if (stat(filename, &file_stat) == 0) mode = file_stat.st_mode & 07777;
+        else
+        {
+            mode_t mask = umask(0);     // umask() can only be read setting it
+            umask(mask);
+            mode = 0666 & ~mask;
+        }
+
+        fchmod(fd, mode);
+
+        written = write_file_data(fd, data, size);
+        close(fd);
+
+        if (!written) unlink(temp_filename);
+    }
+
+    if (written)
+    {
+        if (rename(temp_filename, filename) == 0)
+        {
+            result = RPNG_SUCCESS;
+            RPNG_LOG("FILEIO: [%s] File saved successfully\n", filename);
+        }
+        else unlink(temp_filename);
+    }
+
+    if (result != RPNG_SUCCESS) RPNG_LOG("FILEIO: [%s] Failed to save file\n", filename);
+
+    RPNG_FREE(temp_filename);
+
+    return result;
+}
+#endif
+
 // Write data to file from buffer
 static int save_file_from_buffer(const char *filename, void *data, int bytesToWrite)
 {
     int result = RPNG_SUCCESS;
+
+    if (save_file_callback != NULL)
+    {
+        if ((filename != NULL) && (data != NULL) && (bytesToWrite > 0)) result = save_file_callback(filename, data, bytesToWrite);
+        else RPNG_LOG("FILEIO: File path or data provided are not valid\n");
+
+        return result;
+    }
+
 #if !defined(RPNG_NO_STDIO)
     if ((filename != NULL) && (data != NULL) && (bytesToWrite > 0))
     {
+#if defined(RPNG_FILE_IO_POSIX)
+        if (file_write_mode == RPNG_FILE_WRITE_ATOMIC) return save_file_atomic(filename, (const char *)data, bytesToWrite);
+#endif
         FILE *file = fopen(filename, "wb");
 
         if (file != NULL)
@@ -2322,20 +3365,6 @@ static int save_file_from_buffer(const char *filename, void *data, int bytesToWr
     return result;
 }
 
-// Check if the file exists
-static bool file_exists(const char *filename)
-{
-    bool result = false;
-
-#if defined(_WIN32)
-    if (_access(filename, 0) != -1) result = true;
-#else
-    if (access(filename, F_OK) != -1) result = true;
-#endif
-
-    return result;
-}
-
 #if defined(RPNG_DEFLATE_IMPLEMENTATION)
 
 //=========================================================================
@@ -2828,15 +3857,25 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
   }
 }
 static int
-sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+sdefl_compr_seg(struct sdefl *s, unsigned char *out, const unsigned char *in,
+            int in_begin, int in_len, int lvl, int is_last) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
-  int n, i = 0, litlen = 0;
+  int n, i = in_begin, litlen = 0;
+  if (!is_last) {
+    /* last byte is emitted on a trailing stored block */
+    in_len--;
+  }
   for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
     s->tbl[n] = SDEFL_NIL;
   }
+  /* prime hash chains with preset dictionary [0, in_begin) */
+  for (n = 0; n < in_begin && in_len - n > SDEFL_MIN_MATCH; ++n) {
+    unsigned h = sdefl_hash32(&in[n]);
+    s->prv[n&SDEFL_WIN_MSK] = s->tbl[h];
+    s->tbl[h] = n;
+  }
   do {int blk_begin = i;
     int blk_end = ((i + SDEFL_BLK_MAX) < in_len) ? (i + SDEFL_BLK_MAX) : in_len;
     while (i < blk_end) {
@@ -2886,19 +3925,43 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
+    sdefl_flush(&q, s, is_last && blk_end == in_len, in, blk_begin, blk_end);
   } while (i < in_len);
+  if (!is_last) {
+    /* one byte stored block: output ends byte aligned, so it can be
+     * concatenated with next segment (some inflaters reject empty blocks) */
+    sdefl_put(&q, s, 0x00, 1);
+    sdefl_put(&q, s, 0x00, 2);
+    if (s->bitcnt) {
+      sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+    }
+    sdefl_put16(&q, 0x0001);
+    sdefl_put16(&q, 0xFFFE);
+    *q++ = in[in_len];
+  }
   if (s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
   assert(s->bitcnt == 0);
   return (int)(q - out);
 }
+static int
+sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
+            int in_len, int lvl) {
+  return sdefl_compr_seg(s, out, in, 0, in_len, lvl, 1);
+}
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   s->bits = s->bitcnt = 0;
   return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
 }
+extern int
+sdeflate_segment(struct sdefl *s, void *out, const void *in, int dict_len,
+                 int n, int lvl, int is_last) {
+  s->bits = s->bitcnt = 0;
+  return sdefl_compr_seg(s, (unsigned char*)out, (const unsigned char*)in,
+                         dict_len, dict_len + n, lvl, is_last);
+}
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   #define SDEFL_ADLER_INIT (1)
@@ -2930,6 +3993,10 @@ sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
   }
   return (unsigned)(s2 << 16) + (unsigned)s1;
 }
+extern unsigned
+sdefl_adler(unsigned adler32, const void *in, int in_len) {
+  return sdefl_adler32(adler32, (const unsigned char*)in, in_len);
+}
 extern int
 zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   int p = 0;
@@ -3234,7 +4301,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if ((unsigned short)len != (unsigned short)~nlen)
         return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
+      if (len > (e - s.bitptr) || len > (oe - out) || !len)
         return (int)(out-o);
 
       memcpy(out, s.bitptr, (size_t)len);
@@ -3276,9 +4343,11 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
         switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        case 16: if (!n) return (int)(out-o);
+          for (i=3+sinfl_get(&s,2);i && n<nlit+ndist;i--,n++) lens[n]=lens[n-1];
+          break;
+        case 17: for (i=3+sinfl_get(&s,3);i && n<nlit+ndist;i--,n++) lens[n]=0; break;
+        case 18: for (i=11+sinfl_get(&s,7);i && n<nlit+ndist;i--,n++) lens[n]=0; break;}
       }
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
@@ -3299,6 +4368,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -3319,7 +4391,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         int dsym = sinfl_decode(&s, s.dsts, 8);
         int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
         unsigned char *dst = out, *src = out - offs;
-        if (sinfl_unlikely(offs > (int)(out-o))) {
+        if (sinfl_unlikely(offs > (int)(out-o) || len > (int)(oe-out))) {
           return (int)(out-o);
         }
         out = out + len;
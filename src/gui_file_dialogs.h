@@ -8,6 +8,16 @@
 *
 *   On game draw call:  GuiFileDialog(...);
 *
+*   NOTES:
+*     - GuiFileDialogAsync() shows native dialogs on a worker thread, it must be called every
+*       frame while dialog is required, returns -1 while dialog is shown (main loop not blocked)
+*     - GuiFileDialogPreload() probes native dialogs backends on a worker thread (once),
+*       tinyfiledialogs caches backends found for later dialogs (no probing processes spawned)
+*     - GuiFileDialogUnload() must be called before closing window, finished worker thread is
+*       joined, dialog still shown is detached (its result discarded)
+*     - Async dialogs require PLATFORM_DESKTOP and native dialogs (no CUSTOM_MODAL_DIALOGS),
+*       otherwise they work as GuiFileDialog()
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2019-2025 raylib technologies (@raylibtech).
@@ -69,6 +79,9 @@ extern "C" {            // Prevents name mangling of functions
 // NOTE 2: Value returned is the operation result, on custom dialogs represents button option pressed
 // NOTE 3: filters and message are used for buttons and dialog messages on DIALOG_MESSAGE and DIALOG_TEXTINPUT
 int GuiFileDialog(int dialogType, const char *title, char *fileName, const char *filters, const char *message);
+int GuiFileDialogAsync(int dialogType, const char *title, char *fileName, const char *filters, const char *message); // Returns -1 while dialog is shown
+void GuiFileDialogPreload(void);    // Probe native dialogs backends on background
+void GuiFileDialogUnload(void);     // Unload async dialogs, worker thread joined or detached
 
 #ifdef __cplusplus
 }
@@ -93,20 +106,60 @@ int GuiFileDialog(int dialogType, const char *title, char *fileName, const char
     #include "raygui.h"
 #endif
 
+#include <stdbool.h>                        // Required for: bool
+#include <string.h>                         // Required for: strcpy(), strncpy(), strcmp()
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+// Native dialogs shown on a worker thread, result polled by main loop
+#if defined(PLATFORM_DESKTOP) && !defined(CUSTOM_MODAL_DIALOGS)
+    #define GUI_FILE_DIALOGS_ASYNC
+#endif
+
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+    #include "worker_thread.h"  // Required for: StartWorkerThread(), IsWorkerThreadFinished(), JoinWorkerThread(), DetachWorkerThread()
+
+    #define MAX_DIALOG_FILTERS          16      // Max filter patterns for async dialogs
+    #define MAX_DIALOG_FILENAME_SIZE  1024      // Max file name size for async dialogs (same as tinyfiledialogs)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+// Async dialog request, parameters copied for worker thread
+// NOTE: Only one dialog shown at a time, backends probe is a request without dialog
+typedef struct AsyncDialog {
+    WorkerThread worker;                            // Dialog worker thread, running until joined (main thread only)
+    bool probe;                                     // Request is a backends probe, no dialog shown
+    int type;                                       // Dialog type
+    char title[256];                                // Dialog title
+    char fileName[MAX_DIALOG_FILENAME_SIZE];        // Default file name, selected file name once finished
+    char filters[256];                              // Filter patterns, split in place
+    const char *filterPatterns[MAX_DIALOG_FILTERS]; // Filter patterns pointers (into filters)
+    int filterCount;                                // Filter patterns count
+    char message[256];                              // Dialog message (filters description)
+    int result;                                     // Dialog result, written by worker thread
+} AsyncDialog;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+static AsyncDialog asyncDialog = { 0 };
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP) && !defined(CUSTOM_MODAL_DIALOGS)
+static int NativeFileDialog(int dialogType, const char *title, char *fileName, int filterCount, const char **filters, const char *message); // Show native dialog (blocking)
+#endif
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+static bool StartAsyncDialog(bool probe, int dialogType, const char *title, const char *fileName, const char *filters, const char *message); // Start async dialog worker thread
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -130,30 +183,137 @@ int GuiFileDialog(int dialogType, const char *title, char *fileName, const char
     }
 #else   // Use native OS dialogs (tinyfiledialogs)
 
-    char *tempFileName = NULL;
     int filterCount = 0;
     const char **filterSplit = (const char **)TextSplit(filters, ';', &filterCount);
-    
+
+    result = NativeFileDialog(dialogType, title, fileName, filterCount, filterSplit, message);
+#endif
+
+    return result;
+}
+
+// Multiplatform file dialogs, native dialogs shown on a worker thread
+// NOTE: Returns -1 while dialog is shown, fileName only written once dialog is finished
+int GuiFileDialogAsync(int dialogType, const char *title, char *fileName, const char *filters, const char *message)
+{
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+    int result = -1;
+
+    if (asyncDialog.worker.running)
+    {
+        if (IsWorkerThreadFinished(&asyncDialog.worker))
+        {
+            JoinWorkerThread(&asyncDialog.worker);
+
+            // Result only returned to same dialog request, probes and abandoned dialogs results discarded
+            if (!asyncDialog.probe && (asyncDialog.type == dialogType) && (strcmp(asyncDialog.title, (title != NULL)? title : "") == 0))
+            {
+                if (asyncDialog.result == 1) strcpy(fileName, asyncDialog.fileName);
+                return asyncDialog.result;
+            }
+        }
+        else return -1;
+    }
+
+    // In case worker thread can not be created, dialog is shown right now
+    if (!StartAsyncDialog(false, dialogType, title, fileName, filters, message)) result = GuiFileDialog(dialogType, title, fileName, filters, message);
+
+    return result;
+#else
+    return GuiFileDialog(dialogType, title, fileName, filters, message);
+#endif
+}
+
+// Probe native dialogs backends on background
+// NOTE: tinyfiledialogs caches backends found, later dialogs spawn no probing processes
+void GuiFileDialogPreload(void)
+{
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+    if (!asyncDialog.worker.running) StartAsyncDialog(true, DIALOG_SAVE_FILE, "tinyfd_query", NULL, NULL, NULL);
+#endif
+}
+
+// Unload async dialogs, worker thread joined or detached
+// NOTE: Native dialog still shown can not be closed, its worker thread is detached
+// instead of waiting for user; no dialogs can be requested afterwards
+void GuiFileDialogUnload(void)
+{
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+    if (IsWorkerThreadFinished(&asyncDialog.worker)) JoinWorkerThread(&asyncDialog.worker);
+    else DetachWorkerThread(&asyncDialog.worker);
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP) && !defined(CUSTOM_MODAL_DIALOGS)
+// Show native dialog (blocking), filters already split
+static int NativeFileDialog(int dialogType, const char *title, char *fileName, int filterCount, const char **filters, const char *message)
+{
+    int result = -1;
+    char *tempFileName = NULL;
+
     switch (dialogType)
     {
-        case DIALOG_OPEN_FILE: tempFileName = tinyfd_openFileDialog(title, fileName, filterCount, filterSplit, message, 0); break;
-        case DIALOG_OPEN_FILE_MULTI: tempFileName = tinyfd_openFileDialog(title, fileName, filterCount, filterSplit, message, 1); break;
+        case DIALOG_OPEN_FILE: tempFileName = tinyfd_openFileDialog(title, fileName, filterCount, filters, message, 0); break;
+        case DIALOG_OPEN_FILE_MULTI: tempFileName = tinyfd_openFileDialog(title, fileName, filterCount, filters, message, 1); break;
         case DIALOG_OPEN_DIRECTORY: tempFileName = tinyfd_selectFolderDialog(title, fileName); break;
-        case DIALOG_SAVE_FILE: tempFileName = tinyfd_saveFileDialog(title, fileName, filterCount, filterSplit, message); break;
+        case DIALOG_SAVE_FILE: tempFileName = tinyfd_saveFileDialog(title, fileName, filterCount, filters, message); break;
         case DIALOG_MESSAGE: result = tinyfd_messageBox(title, message, "ok", "info", 0); break;
         case DIALOG_TEXTINPUT: tempFileName = tinyfd_inputBox(title, message, ""); break;
         default: break;
     }
 
-    if (tempFileName != NULL) 
+    if (tempFileName != NULL)
     {
         strcpy(fileName, tempFileName);
         result = 1;
     }
     else result = 0;
-#endif
 
     return result;
 }
+#endif
+
+#if defined(GUI_FILE_DIALOGS_ASYNC)
+// Async dialog worker
+static void AsyncDialogWorker(void *arg)
+{
+    // NOTE: Probe query returns without showing any dialog, once backends are detected
+    if (asyncDialog.probe) tinyfd_saveFileDialog("tinyfd_query", "", 0, NULL, NULL);
+    else asyncDialog.result = NativeFileDialog(asyncDialog.type, asyncDialog.title, asyncDialog.fileName, asyncDialog.filterCount, asyncDialog.filterPatterns, asyncDialog.message);
+}
+
+// Start async dialog worker thread, parameters copied for the thread
+// NOTE: Filters split here, TextSplit() static buffer can not be used from worker thread
+static bool StartAsyncDialog(bool probe, int dialogType, const char *title, const char *fileName, const char *filters, const char *message)
+{
+    asyncDialog.probe = probe;
+    asyncDialog.type = dialogType;
+    asyncDialog.result = 0;
+    strncpy(asyncDialog.title, (title != NULL)? title : "", 255);
+    strncpy(asyncDialog.fileName, (fileName != NULL)? fileName : "", MAX_DIALOG_FILENAME_SIZE - 1);
+    strncpy(asyncDialog.filters, (filters != NULL)? filters : "", 255);
+    strncpy(asyncDialog.message, (message != NULL)? message : "", 255);
+
+    asyncDialog.filterCount = 0;
+    if (asyncDialog.filters[0] != '\0')
+    {
+        asyncDialog.filterPatterns[asyncDialog.filterCount++] = asyncDialog.filters;
+
+        for (int i = 0; (asyncDialog.filters[i] != '\0') && (asyncDialog.filterCount < MAX_DIALOG_FILTERS); i++)
+        {
+            if (asyncDialog.filters[i] == ';')
+            {
+                asyncDialog.filters[i] = '\0';
+                asyncDialog.filterPatterns[asyncDialog.filterCount++] = asyncDialog.filters + i + 1;
+            }
+        }
+    }
+
+    return StartWorkerThread(&asyncDialog.worker, AsyncDialogWorker, NULL);
+}
+#endif  // GUI_FILE_DIALOGS_ASYNC
 
 #endif // GUI_WINDOW_ABOUT_IMPLEMENTATION
\ No newline at end of file
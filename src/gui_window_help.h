@@ -122,9 +122,12 @@ static const char *helpLines[] = {
     "LCTRL + X,C,V - Cut, copy, paste icon",
     "LCTRL + Z,Y - Undo/Redo icon edition",
     "DEL - Clean current selected icon",
+    "MOUSE LEFT | RIGHT - Draw | Erase with tool",
+    "F5 - Show icons similar to selected",
     "-Tool Visuals",
     "LEFT | RIGHT - Select style template",
     "LCTRL + F - Toggle double screen size",
+    "F10 - Toggle frame profiler",
     "-",
     "ESCAPE - Close Window/Exit",
     NULL
@@ -0,0 +1,829 @@
+/*******************************************************************************************
+*
+*   Iconset
+*
+*   MODULE USAGE:
+*       #define ICONSET_IMPLEMENTATION
+*       #include "iconset.h"
+*
+*   On iconset load/save:  LoadIconsFromImage(...), SaveIcons(...), ExportIconsAsImage(...), ExportIconsAsCode(...)
+*
+*   NOTES:
+*     - Current iconset (currentIcons) and icons name ids (guiIconsName) are defined by this module
+*     - raygui.h must be included before this module, implementation also requires rpng.h
+*       implementation and raylib (or cli_backend.h) functions: LoadFileData(), SaveFileData(),
+*       DecompressData(), TextFormat(), DrawRectangle()
+*     - Shared by rGuiIcons tool, command-line only build and headless benchmark
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019-2025 raylib technologies (@raylibtech).
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef ICONSET_H
+#define ICONSET_H
+
+#include <stdio.h>                          // Required for: FILE
+#include <stdbool.h>                        // Required for: bool
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RGI_BIT_CHECK(a,b)  ((a) &  (1u<<(b)))
+#define RGI_BIT_SET(a,b)    ((a) |= (1u<<(b)))
+#define RGI_BIT_CLEAR(a,b)  ((a) &= ~((1u)<<(b)))
+
+//----------------------------------------------------------------------------------
+// Global Variables Declaration
+//----------------------------------------------------------------------------------
+extern char guiIconsName[RAYGUI_ICON_MAX_ICONS][32];                                // Icons name id text
+extern unsigned int currentIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS];  // Current iconset data
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Load/Save/Export data functions
+int LoadIconsFromImage(const char *fileName, int iconsPerLine, int padding); // Load icons from image file (.png)
+int LoadIconsFromImageMemory(const unsigned char *fileData, int dataSize, int iconsPerLine, int padding); // Load icons from image file data (.png)
+int LoadIconsFromMemory(const unsigned char *fileData, int dataSize); // Load icons from .rgi file data, no allocations
+int SaveIcons(const char *fileName);                 // Save raygui icons file (.rgi)
+int SaveIconsData(const char *fileName, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH]); // Save icons data as raygui icons file (.rgi), thread-safe
+int SaveIconsToStream(FILE *stream, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH]); // Save icons data as raygui icons file (.rgi) to stream
+int ExportIconsAsImage(const char *fileName, bool nameIds); // Export gui icons as 1-bit image (.png)
+char *ExportIconsAsImageToMemory(bool nameIds, int *dataSize); // Export gui icons as 1-bit image (.png) to memory, must be freed with RPNG_FREE()
+int ExportIconsAsCode(const char *fileName);         // Export gui icons as code (.h)
+int ExportIconsAsCodeToStream(FILE *codeFile);       // Export gui icons as code (.h) to stream
+
+// Icon drawing functions
+void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color); // Draw selected icon from iconset
+void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color);                 // Draw one icon, icon data provided directly
+
+// Icon data functions
+unsigned int *GetIconData(unsigned int *iconset, int iconId);             // Get icon bit data
+void SetIconData(unsigned int *iconset, int iconId, unsigned int *data);  // Set icon bit data
+void SetIconPixel(unsigned int *iconset, int iconId, int x, int y);       // Set icon pixel value
+void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Clear icon pixel value
+bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Check icon pixel value
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ICONSET_H
+
+
+/***********************************************************************************
+*
+*   ICONSET IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(ICONSET_IMPLEMENTATION)
+
+#include <string.h>                         // Required for: memset(), memcpy(), memcmp(), strlen()
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Icons name id text
+char guiIconsName[RAYGUI_ICON_MAX_ICONS][32] = {
+    "NONE",
+    "FOLDER_FILE_OPEN",
+    "FILE_SAVE_CLASSIC",
+    "FOLDER_OPEN",
+    "FOLDER_SAVE",
+    "FILE_OPEN",
+    "FILE_SAVE",
+    "FILE_EXPORT",
+    "FILE_ADD",
+    "FILE_DELETE",
+    "FILETYPE_TEXT",
+    "FILETYPE_AUDIO",
+    "FILETYPE_IMAGE",
+    "FILETYPE_PLAY",
+    "FILETYPE_VIDEO",
+    "FILETYPE_INFO",
+    "FILE_COPY",
+    "FILE_CUT",
+    "FILE_PASTE",
+    "CURSOR_HAND",
+    "CURSOR_POINTER",
+    "CURSOR_CLASSIC",
+    "PENCIL",
+    "PENCIL_BIG",
+    "BRUSH_CLASSIC",
+    "BRUSH_PAINTER",
+    "WATER_DROP",
+    "COLOR_PICKER",
+    "RUBBER",
+    "COLOR_BUCKET",
+    "TEXT_T",
+    "TEXT_A",
+    "SCALE",
+    "RESIZE",
+    "FILTER_POINT",
+    "FILTER_BILINEAR",
+    "CROP",
+    "CROP_ALPHA",
+    "SQUARE_TOGGLE",
+    "SYMMETRY",
+    "SYMMETRY_HORIZONTAL",
+    "SYMMETRY_VERTICAL",
+    "LENS",
+    "LENS_BIG",
+    "EYE_ON",
+    "EYE_OFF",
+    "FILTER_TOP",
+    "FILTER",
+    "TARGET_POINT",
+    "TARGET_SMALL",
+    "TARGET_BIG",
+    "TARGET_MOVE",
+    "CURSOR_MOVE",
+    "CURSOR_SCALE",
+    "CURSOR_SCALE_RIGHT",
+    "CURSOR_SCALE_LEFT",
+    "UNDO",
+    "REDO",
+    "REREDO",
+    "MUTATE",
+    "ROTATE",
+    "REPEAT",
+    "SHUFFLE",
+    "EMPTYBOX",
+    "TARGET",
+    "TARGET_SMALL_FILL",
+    "TARGET_BIG_FILL",
+    "TARGET_MOVE_FILL",
+    "CURSOR_MOVE_FILL",
+    "CURSOR_SCALE_FILL",
+    "CURSOR_SCALE_RIGHT_FILL",
+    "CURSOR_SCALE_LEFT_FILL",
+    "UNDO_FILL",
+    "REDO_FILL",
+    "REREDO_FILL",
+    "MUTATE_FILL",
+    "ROTATE_FILL",
+    "REPEAT_FILL",
+    "SHUFFLE_FILL",
+    "EMPTYBOX_SMALL",
+    "BOX",
+    "BOX_TOP",
+    "BOX_TOP_RIGHT",
+    "BOX_RIGHT",
+    "BOX_BOTTOM_RIGHT",
+    "BOX_BOTTOM",
+    "BOX_BOTTOM_LEFT",
+    "BOX_LEFT",
+    "BOX_TOP_LEFT",
+    "BOX_CENTER",
+    "BOX_CIRCLE_MASK",
+    "POT",
+    "ALPHA_MULTIPLY",
+    "ALPHA_CLEAR",
+    "DITHERING",
+    "MIPMAPS",
+    "BOX_GRID",
+    "GRID",
+    "BOX_CORNERS_SMALL",
+    "BOX_CORNERS_BIG",
+    "FOUR_BOXES",
+    "GRID_FILL",
+    "BOX_MULTISIZE",
+    "ZOOM_SMALL",
+    "ZOOM_MEDIUM",
+    "ZOOM_BIG",
+    "ZOOM_ALL",
+    "ZOOM_CENTER",
+    "BOX_DOTS_SMALL",
+    "BOX_DOTS_BIG",
+    "BOX_CONCENTRIC",
+    "BOX_GRID_BIG",
+    "OK_TICK",
+    "CROSS",
+    "ARROW_LEFT",
+    "ARROW_RIGHT",
+    "ARROW_DOWN",
+    "ARROW_UP",
+    "ARROW_LEFT_FILL",
+    "ARROW_RIGHT_FILL",
+    "ARROW_DOWN_FILL",
+    "ARROW_UP_FILL",
+    "AUDIO",
+    "FX",
+    "WAVE",
+    "WAVE_SINUS",
+    "WAVE_SQUARE",
+    "WAVE_TRIANGULAR",
+    "CROSS_SMALL",
+    "PLAYER_PREVIOUS",
+    "PLAYER_PLAY_BACK",
+    "PLAYER_PLAY",
+    "PLAYER_PAUSE",
+    "PLAYER_STOP",
+    "PLAYER_NEXT",
+    "PLAYER_RECORD",
+    "MAGNET",
+    "LOCK_CLOSE",
+    "LOCK_OPEN",
+    "CLOCK",
+    "TOOLS",
+    "GEAR",
+    "GEAR_BIG",
+    "BIN",
+    "HAND_POINTER",
+    "LASER",
+    "COIN",
+    "EXPLOSION",
+    "1UP",
+    "PLAYER",
+    "PLAYER_JUMP",
+    "KEY",
+    "DEMON",
+    "TEXT_POPUP",
+    "GEAR_EX",
+    "CRACK",
+    "CRACK_POINTS",
+    "STAR",
+    "DOOR",
+    "EXIT",
+    "MODE_2D",
+    "MODE_3D",
+    "CUBE",
+    "CUBE_FACE_TOP",
+    "CUBE_FACE_LEFT",
+    "CUBE_FACE_FRONT",
+    "CUBE_FACE_BOTTOM",
+    "CUBE_FACE_RIGHT",
+    "CUBE_FACE_BACK",
+    "CAMERA",
+    "SPECIAL",
+    "LINK_NET",
+    "LINK_BOXES",
+    "LINK_MULTI",
+    "LINK",
+    "LINK_BROKE",
+    "TEXT_NOTES",
+    "NOTEBOOK",
+    "SUITCASE",
+    "SUITCASE_ZIP",
+    "MAILBOX",
+    "MONITOR",
+    "PRINTER",
+    "PHOTO_CAMERA",
+    "PHOTO_CAMERA_FLASH",
+    "HOUSE",
+    "HEART",
+    "CORNER",
+    "VERTICAL_BARS",
+    "VERTICAL_BARS_FILL",
+    "LIFE_BARS",
+    "INFO",
+    "CROSSLINE",
+    "HELP",
+    "FILETYPE_ALPHA",
+    "FILETYPE_HOME",
+    "LAYERS_VISIBLE",
+    "LAYERS",
+    "WINDOW",
+    "HIDPI",
+    "FILETYPE_BINARY",
+    "HEX",
+    "SHIELD",
+    "FILE_NEW",
+    "FOLDER_ADD",
+    "ALARM",
+    "CPU",
+    "ROM",
+    "STEP_OVER",
+    "STEP_INTO",
+    "STEP_OUT",
+    "RESTART",
+    "BREAKPOINT_ON",
+    "BREAKPOINT_OFF",
+    "BURGER_MENU",
+    "CASE_SENSITIVE",
+    "REG_EXP",
+    "FOLDER",
+    "FILE",
+    "TEMPO",
+    "WARNING",
+    "HELP_BOX",
+    "INFO_BOX",
+    "PRIORITY",
+    "LAYERS_ISO",
+    "LAYERS2",
+    "MLAYERS",
+    "MAPS",
+    "HOT",
+    "LABEL",
+    "NAME_ID",
+    "SLICING",
+    "MANUAL_CONTROL",
+    "COLLISION",
+};
+
+unsigned int currentIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Load icons from image file (.png)
+// NOTE: Image is decoded at its native bit depth by rpng, icons are expected
+// to be laid out in lines of iconsPerLine, with padding pixels around every icon;
+// any pixel with value >= 128 (and alpha >= 128, if available) is considered set.
+// Icons name ids are loaded from the zTXt "Description" chunk, if available
+int LoadIconsFromImage(const char *fileName, int iconsPerLine, int padding)
+{
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    int iconCount = LoadIconsFromImageMemory(fileData, dataSize, iconsPerLine, padding);
+
+    UnloadFileData(fileData);
+
+    return iconCount;
+}
+
+// Load icons from image file data (.png), expected layout: iconsPerLine icons per line, padding around every icon
+// NOTE: Icons name ids also loaded from PNG zTXt chunk if available
+int LoadIconsFromImageMemory(const unsigned char *fileData, int dataSize, int iconsPerLine, int padding)
+{
+    int iconCount = 0;
+
+    if (fileData == NULL) return 0;
+
+    int width = 0, height = 0, channels = 0, bitDepth = 0;
+    unsigned char *data = (unsigned char *)rpng_load_image_from_memory((const char *)fileData, dataSize, &width, &height, &channels, &bitDepth);
+
+    if (data != NULL)
+    {
+        // Sub-byte depths are expanded to 8-bit, 16-bit samples are read by its high byte
+        if (bitDepth < 8)
+        {
+            unsigned char *unpacked = (unsigned char *)rpng_unpack_image_data((const char *)data, width, height, bitDepth, true);
+            RPNG_FREE(data);
+            data = unpacked;
+        }
+
+        int pixelSize = (bitDepth == 16)? channels*2 : channels;
+        int cellSize = RAYGUI_ICON_SIZE + 2*padding;
+        int lines = height/cellSize;
+        int columns = (width/cellSize < iconsPerLine)? width/cellSize : iconsPerLine;     // Images narrower than iconsPerLine supported
+
+        iconCount = columns*lines;
+        if (iconCount > RAYGUI_ICON_MAX_ICONS) iconCount = RAYGUI_ICON_MAX_ICONS;
+
+        // Clear previous iconset, images with less icons must not keep previous icons/names
+        if ((data != NULL) && (iconCount > 0))
+        {
+            memset(currentIcons, 0, sizeof(currentIcons));
+            memset(guiIconsName, 0, sizeof(guiIconsName));
+        }
+
+        for (int n = 0; (data != NULL) && (n < iconCount); n++)
+        {
+            int offsetX = padding + (n%columns)*cellSize;
+            int offsetY = padding + (n/columns)*cellSize;
+
+            for (int y = 0; y < RAYGUI_ICON_SIZE; y++)
+            {
+                const unsigned char *pixel = data + ((offsetY + y)*width + offsetX)*pixelSize;
+
+                for (int x = 0; x < RAYGUI_ICON_SIZE; x++, pixel += pixelSize)
+                {
+                    bool set = (pixel[0] >= 128);
+                    if ((channels == 2) || (channels == 4)) set = set && (pixel[(pixelSize/channels)*(channels - 1)] >= 128);
+
+                    if (set) SetIconPixel(currentIcons, n, x, y);
+                    else ClearIconPixel(currentIcons, n, x, y);
+                }
+            }
+        }
+
+        if (data == NULL) iconCount = 0;
+        RPNG_FREE(data);
+
+        // Load icons name ids from PNG zTXt chunk
+        rpng_chunk_index index = rpng_chunk_index_from_memory((const char *)fileData, dataSize);
+
+        for (int pos = rpng_chunk_index_find(index, "zTXt", 0); (iconCount > 0) && (pos >= 0); pos = rpng_chunk_index_find(index, "zTXt", pos + 1))
+        {
+            rpng_chunk chunk = rpng_chunk_view(index, pos);
+            int keywordLength = (int)strlen("Description");
+
+            // zTXt chunk data: keyword + null separator + compression method + compressed text
+            if ((chunk.length > (keywordLength + 8)) && (memcmp(chunk.data, "Description", keywordLength + 1) == 0))
+            {
+                int textSize = 0;
+                char *text = (char *)DecompressData((unsigned char *)chunk.data + keywordLength + 2 + 2, chunk.length - keywordLength - 2 - 2 - 4, &textSize);
+
+                if (text != NULL)
+                {
+                    for (int i = 0, start = 0, k = 0; (i <= textSize) && (k < RAYGUI_ICON_MAX_ICONS); i++)
+                    {
+                        if ((i == textSize) || (text[i] == ';'))
+                        {
+                            int length = ((i - start) < (RAYGUI_ICON_MAX_NAME_LENGTH - 1))? (i - start) : (RAYGUI_ICON_MAX_NAME_LENGTH - 1);
+                            memset(guiIconsName[k], 0, RAYGUI_ICON_MAX_NAME_LENGTH);
+                            memcpy(guiIconsName[k], text + start, length);
+                            start = i + 1;
+                            k++;
+                        }
+                    }
+
+                    MemFree(text);
+                }
+
+                break;
+            }
+        }
+
+        rpng_chunk_index_unload(index);
+    }
+
+    return iconCount;
+}
+
+// Load icons from .rgi file data, icons data and name ids loaded into current iconset
+// NOTE: No memory allocated, only iconsets with RAYGUI_ICON_SIZE icons supported
+int LoadIconsFromMemory(const unsigned char *fileData, int dataSize)
+{
+    int iconCount = 0;
+
+    if ((fileData != NULL) && (dataSize >= 12) && (memcmp(fileData, "rGI ", 4) == 0))
+    {
+        short count = 0;
+        short size = 0;
+        memcpy(&count, fileData + 8, sizeof(short));
+        memcpy(&size, fileData + 10, sizeof(short));
+
+        int iconDataSize = RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int);
+
+        if ((size == RAYGUI_ICON_SIZE) && (count > 0) && (count <= RAYGUI_ICON_MAX_ICONS) &&
+            ((12 + count*(RAYGUI_ICON_MAX_NAME_LENGTH + iconDataSize)) <= dataSize))
+        {
+            // Clear previous iconset, files with less icons must not keep previous icons/names
+            memset(currentIcons, 0, sizeof(currentIcons));
+            memset(guiIconsName, 0, sizeof(guiIconsName));
+
+            for (int i = 0; i < count; i++)
+            {
+                memcpy(guiIconsName[i], fileData + 12 + i*RAYGUI_ICON_MAX_NAME_LENGTH, RAYGUI_ICON_MAX_NAME_LENGTH);
+                guiIconsName[i][RAYGUI_ICON_MAX_NAME_LENGTH - 1] = '\0';
+            }
+
+            memcpy(currentIcons, fileData + 12 + count*RAYGUI_ICON_MAX_NAME_LENGTH, count*iconDataSize);
+            iconCount = count;
+        }
+    }
+
+    return iconCount;
+}
+
+// Save raygui icons file (.rgi)
+int SaveIcons(const char *fileName)
+{
+    return SaveIconsData(fileName, currentIcons, guiIconsName);
+}
+
+// Save icons data as raygui icons file (.rgi)
+// NOTE: No global state accessed, also used by autosave worker thread
+int SaveIconsData(const char *fileName, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH])
+{
+    int result = -1;
+    FILE *rgiFile = fopen(fileName, "wb");
+
+    if (rgiFile != NULL)
+    {
+        result = SaveIconsToStream(rgiFile, icons, names);
+        if (fclose(rgiFile) != 0) result = -1;
+    }
+
+    return result;
+}
+
+// Save icons data as raygui icons file (.rgi) to stream
+int SaveIconsToStream(FILE *stream, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH])
+{
+    // raygui Icons File Structure (.rgi)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rGI "
+    // 4       | 2       | short      | Version: 100
+    // 6       | 2       | short      | reserved
+
+    // 8       | 2       | short      | Num icons (N)
+    // 10      | 2       | short      | Icons size (Options: 16, 32, 64) (S)
+
+    // Icons name id (32 bytes per name id)
+    // foreach (icon)
+    // {
+    //   12+32*i  | 32   | char       | Icon NameId
+    // }
+
+    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
+    // S*S pixels/32bit per unsigned int = K unsigned int per icon
+    // foreach (icon)
+    // {
+    //   ...   | K       | unsigned int | Icon Data
+    // }
+
+    int result = -1;
+
+    if (stream != NULL)
+    {
+        char signature[5] = "rGI ";
+        short version = 100;
+        short reserved = 0;
+        short iconCount = RAYGUI_ICON_MAX_ICONS;
+        short iconSize = RAYGUI_ICON_SIZE;
+
+        fwrite(signature, sizeof(char), 4, stream);
+        fwrite(&version, sizeof(short), 1, stream);
+        fwrite(&reserved, sizeof(short), 1, stream);
+        fwrite(&iconCount, sizeof(short), 1, stream);
+        fwrite(&iconSize, sizeof(short), 1, stream);
+
+        for (int i = 0; i < iconCount; i++)
+        {
+            // Write icons name id
+            fwrite(names[i], 1, RAYGUI_ICON_MAX_NAME_LENGTH, stream);
+        }
+
+        for (int i = 0; i < iconCount; i++)
+        {
+            // Write icons data
+            fwrite(&icons[i*RAYGUI_ICON_DATA_ELEMENTS], sizeof(unsigned int), (iconSize*iconSize/32), stream);
+        }
+
+        result = ferror(stream)? -1 : 0;
+    }
+
+    return result;
+}
+
+// Export gui icons as 1-bit image (.png)
+int ExportIconsAsImage(const char *fileName, bool nameIds)
+{
+    int result = -1;
+    int fileDataSize = 0;
+    char *fileData = ExportIconsAsImageToMemory(nameIds, &fileDataSize);
+
+    if (fileData != NULL)
+    {
+        result = SaveFileData(fileName, fileData, fileDataSize)? 0 : -1;
+        RPNG_FREE(fileData);
+    }
+
+    return result;
+}
+
+// Export gui icons as 1-bit image (.png) to memory, must be freed with RPNG_FREE()
+// NOTE: Image bits are packed directly from icon data, no intermediate RGBA image
+// required; layout: 16 icons per line, 1 pixel padding around every icon
+char *ExportIconsAsImageToMemory(bool nameIds, int *dataSize)
+{
+    int iconsPerLine = 16;
+    int padding = 1;
+    int cellSize = RAYGUI_ICON_SIZE + 2*padding;
+    int lines = RAYGUI_ICON_MAX_ICONS/iconsPerLine + ((RAYGUI_ICON_MAX_ICONS%iconsPerLine > 0)? 1 : 0);
+
+    int width = iconsPerLine*cellSize;
+    int height = lines*cellSize;
+    int scanlineSize = (width + 7)/8;
+
+    // Gen 1-bit grayscale image data, MSB first (white pixels for set bits)
+    unsigned char *bits = (unsigned char *)RL_CALLOC(scanlineSize*height, 1);
+
+    for (int n = 0; n < RAYGUI_ICON_MAX_ICONS; n++)
+    {
+        int offsetX = padding + (n%iconsPerLine)*cellSize;
+        int offsetY = padding + (n/iconsPerLine)*cellSize;
+
+        for (int y = 0; y < RAYGUI_ICON_SIZE; y++)
+        {
+            // Every icon row is half a 32-bit icon word, LSB first
+            unsigned int row = (currentIcons[n*RAYGUI_ICON_DATA_ELEMENTS + y/2] >> ((y%2)*16)) & 0xffff;
+            if (row == 0) continue;
+
+            unsigned char *scanline = bits + (offsetY + y)*scanlineSize;
+
+            for (int x = 0; x < RAYGUI_ICON_SIZE; x++)
+            {
+                if (row & (1u << x)) scanline[(offsetX + x)/8] |= (0x80 >> ((offsetX + x)%8));
+            }
+        }
+    }
+
+    char *fileData = rpng_save_image_to_memory((const char *)bits, width, height, 1, 1, dataSize);
+    RL_FREE(bits);
+
+    if ((fileData != NULL) && nameIds)
+    {
+        // Concatenate all icons names into one string
+        char *iconsNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*32, 1);
+        char *iconsNamesPtr = iconsNames;
+        for (int i = 0, size = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        {
+            size = strlen(guiIconsName[i]);
+            memcpy(iconsNamesPtr, guiIconsName[i], size);
+            iconsNamesPtr[size] = ';';
+            iconsNamesPtr += (size + 1);
+        }
+
+        // Save icons name id into PNG zTXt chunk, file data is generated once
+        rpng_chunk_edit *edit = rpng_chunk_edit_begin_from_memory(fileData);
+        rpng_chunk_edit_add_comp_text(edit, "Description", iconsNames);
+        char *editedData = rpng_chunk_edit_commit_to_memory(edit, dataSize);
+        RL_FREE(iconsNames);
+
+        RPNG_FREE(fileData);
+        fileData = editedData;
+    }
+
+    return fileData;
+}
+
+// Export gui icons as code (.h)
+int ExportIconsAsCode(const char *fileName)
+{
+    int result = -1;
+    FILE *codeFile = fopen(fileName, "wt");
+
+    if (codeFile != NULL)
+    {
+        result = ExportIconsAsCodeToStream(codeFile);
+        if (fclose(codeFile) != 0) result = -1;
+    }
+
+    return result;
+}
+
+// Export gui icons as code (.h) to stream
+// NOTE: Returns -1 in case of stream write errors
+int ExportIconsAsCodeToStream(FILE *codeFile)
+{
+    int result = -1;
+
+    if (codeFile != NULL)
+    {
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// raygui Icons exporter v1.1 - Icons data exported as a values array           //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
+        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "// Copyright (c) 2019-2025 raylib technologies (@raylibtech)                    //\n");
+        fprintf(codeFile, "//                                                                              //\n");
+        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+        fprintf(codeFile, "// Defines and Macros\n");
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+        fprintf(codeFile, "#define RAYGUI_ICON_SIZE             %i   // Size of icons (squared)\n", RAYGUI_ICON_SIZE);
+        fprintf(codeFile, "#define RAYGUI_ICON_MAX_ICONS       %i   // Maximum number of icons\n", RAYGUI_ICON_MAX_ICONS);
+        fprintf(codeFile, "#define RAYGUI_ICON_MAX_NAME_LENGTH  %i   // Maximum length of icon name id\n\n", RAYGUI_ICON_MAX_NAME_LENGTH);
+
+        fprintf(codeFile, "// Icons data is defined by bit array (every bit represents one pixel)\n");
+        fprintf(codeFile, "// Those arrays are stored as unsigned int data arrays, so every array\n");
+        fprintf(codeFile, "// element defines 32 pixels (bits) of information\n");
+        fprintf(codeFile, "// Number of elemens depend on RAYGUI_ICON_SIZE (by default 16x16 pixels)\n");
+        fprintf(codeFile, "#define RAYGUI_ICON_DATA_ELEMENTS   (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32)\n\n");
+
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+        fprintf(codeFile, "// Icons enumeration\n");
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+
+        fprintf(codeFile, "typedef enum {\n");
+        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) fprintf(codeFile, "    ICON_%-24s = %i,\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i), i);
+        fprintf(codeFile, "} guiIconName;\n\n");
+
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+        fprintf(codeFile, "// Icons data\n");
+        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
+
+        fprintf(codeFile, "static unsigned int guiIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = {\n");
+        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        {
+            unsigned int *icon = GetIconData(currentIcons, i);
+
+            fprintf(codeFile, "    ");
+            for (int j = 0; j < RAYGUI_ICON_DATA_ELEMENTS; j++) fprintf(codeFile, "0x%08x, ", icon[j]);
+
+            fprintf(codeFile, "     // ICON_%s\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i));
+        }
+        fprintf(codeFile, "};\n\n");
+
+        fprintf(codeFile, "// NOTE: A pointer to the current icons array should be defined\n");
+        fprintf(codeFile, "static unsigned int *guiIconsPtr = guiIcons;\n");
+
+        result = ferror(codeFile)? -1 : 0;
+    }
+
+    return result;
+}
+
+// Draw selected icon from iconset
+void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color)
+{
+    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+    {
+        for (int k = 0; k < 32; k++)
+        {
+            if (RGI_BIT_CHECK(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            {
+                // NOTE: We draw the icon pixel-by-pixel using rectangles
+                DrawRectangle(posX + (k%RAYGUI_ICON_SIZE)*pixelSize, posY + y*pixelSize, pixelSize, pixelSize, color);
+            }
+
+            if ((k == 15) || (k == 31)) y++;
+        }
+    }
+}
+
+// Draw one icon directly providing the full icon data
+void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color)
+{
+    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
+
+    for (int i = 0, j = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+    {
+        for (int k = 0; k < 32; k++)
+        {
+            if (RGI_BIT_CHECK(data[i], k))
+            {
+                // NOTE: We draw the icon pixel-by-pixel using rectangles
+                DrawRectangle(x + (k%RAYGUI_ICON_SIZE)*pixelSize, y + j*pixelSize, pixelSize, pixelSize, color);
+            }
+
+            if ((k == 15) || (k == 31)) j++;
+        }
+    }
+}
+
+// Get icon bit data
+// NOTE: Bit data array grouped as unsigned int (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
+unsigned int *GetIconData(unsigned int *iconset, int iconId)
+{
+    static unsigned int iconData[RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
+    memset(iconData, 0, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(iconData, &iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+    return iconData;
+}
+
+// Set icon pixel value
+void SetIconPixel(unsigned int *iconset, int iconId, int x, int y)
+{
+    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
+    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
+    RGI_BIT_SET(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
+}
+
+// Clear icon pixel value
+void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y)
+{
+    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
+    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
+    RGI_BIT_CLEAR(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
+}
+
+// Set icon bit data
+// NOTE: Data must be provided as unsigned int array (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
+void SetIconData(unsigned int *iconset, int iconId, unsigned int *data)
+{
+    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(&iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+}
+
+// Check icon pixel value
+bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y)
+{
+    return (RGI_BIT_CHECK(iconset[iconId*8 + y/2], x + (y%2*16)));
+}
+
+#endif // ICONSET_IMPLEMENTATION
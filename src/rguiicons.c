@@ -26,6 +26,36 @@
 *           Use custom raygui generated modal dialogs instead of native OS ones
 *           NOTE: Avoids including tinyfiledialogs depencency library
 *
+*       #define SUPPORT_STYLES_BACKGROUND_LOADING
+*           Decompress embedded styles font atlas on background threads at startup,
+*           styles are uploaded and cached progressively, ready when selected
+*           NOTE: Only PLATFORM_DESKTOP, requires pthreads (Win32 threads on MSVC)
+*
+*       #define SUPPORT_IDLE_EVENT_WAITING
+*           Skip screen redraw when nothing changed (input, icons, style, window state),
+*           previous render is re-presented and program waits for events while idle
+*           NOTE: Not available on PLATFORM_WEB, frames are driven by the browser
+*
+*       #define SUPPORT_FRAME_PROFILER
+*           Main loop sections timing and draw calls/rectangles counting, shown on
+*           overlay (F10) and optionally traced per frame to a CSV file (--trace)
+*           NOTE: raylib draw functions are redirected by macro to be counted
+*
+*       #define SUPPORT_WATCH_MODE
+*           Command-line watch mode (--watch), directory watched for .rgi files changes and
+*           changed iconsets reconverted to requested formats (--output-format), debouncing writes
+*           NOTE: Only Linux (inotify), file buffer and deflate state reused between conversions
+*
+*       #define SUPPORT_ICONS_JOURNAL
+*           Loaded iconset changes journaled to a file next to it (<file>.rgi.journal), one checksummed
+*           record appended per changed icon, replayed on next load in case of crash (unsaved changes)
+*           NOTE: Only PLATFORM_DESKTOP, journal compacted once records limit is reached
+*
+*       #define SUPPORT_ICONS_AUTOSAVE
+*           Loaded iconset changes saved periodically (ICONS_AUTOSAVE_INTERVAL) on a background thread,
+*           changed icons copied to a snapshot and file written to a temporary file and renamed
+*           NOTE: Only PLATFORM_DESKTOP, requires pthreads (Win32 threads on MSVC)
+*
 *   VERSIONS HISTORY:
 *       3.1  (06-Apr-2024)  ADDED: Report Issue/Features window (Open GitHub)
 *                           ADDED: New icons: WARNING, HELP_BOX, INFO_BOX
@@ -64,7 +94,7 @@
 *   DEPENDENCIES:
 *       raylib 5.5-dev          - Windowing/input management and drawing
 *       raygui 4.5-dev          - Immediate-mode GUI controls with custom styling and icons
-*       rpng 1.5                - PNG chunks management
+*       rpng 1.6                - PNG chunks management
 *       tinyfiledialogs 3.19.1  - Open/save file dialogs, it requires linkage with comdlg32 and ole32 libs
 *
 *   BUILDING:
@@ -76,8 +106,18 @@
 *       gcc -o rguiicons rguiicons.c external/tinyfiledialogs.c -s -Iexternal -no-pie -D_DEFAULT_SOURCE /
 *           -lraylib -lGL -lm -lpthread -ldl -lrt -lX11
 *
+*     - Command-line only (no raylib, no windowing/graphics), also available with: make cli
+*       gcc -o rguiicons-cli rguiicons.c -s -O2 -flto -Iexternal -DRGUIICONS_CLI_ONLY -DPLATFORM_DESKTOP /
+*           -std=c99 -D_DEFAULT_SOURCE -lm
+*       Profile-guided optimized builds, trained with training/train.sh over .rgi corpus in training/:
+*           make cli-pgo (gcc or clang+llvm-profdata), make cli-bolt (Linux, PGO + llvm-bolt)
+*
 *   ADDITIONAL NOTES:
 *       On PLATFORM_ANDROID and PLATFORM_WEB file dialogs are not available
+*       Iconset load/save/export functions (iconset.h) are shared with headless benchmark
+*       (rguiicons_bench.c), build it with: make bench
+*       Command-line only build (RGUIICONS_CLI_ONLY) compiles just iconset load/save/export
+*       and command-line processing, raygui in standalone mode backed by cli_backend.h
 *
 *   DEVELOPERS:
 *       Ramon Santamaria (@raysan5):   Developer, supervisor, updater and maintainer.
@@ -112,23 +152,64 @@
 #define TOOL_RELEASE_DATE       "Apr.2024"
 #define TOOL_LOGO_COLOR         0x48c9c5ff
 
-#include "raylib.h"
+#if defined(RGUIICONS_CLI_ONLY)
+    // Command-line only build: no windowing/graphics, raygui used in standalone mode
+    // NOTE: Functions required by raygui and the tool are provided by cli_backend.h
+    #include <stdbool.h>                    // Required for: bool
+    #define RAYGUI_STANDALONE
+#else
+    #include "raylib.h"
+#endif
 
 #if defined(PLATFORM_WEB)
     #define CUSTOM_MODAL_DIALOGS            // Force custom modal dialogs usage
     #include <emscripten/emscripten.h>      // Emscripten library - LLVM to JavaScript compiler
 #endif
 
+// Frame profiler: main loop sections timing and draw calls counting
+// NOTE: Draw calls issued to raylib by raygui and the tool are counted redirecting
+// draw functions, so it must be defined before including raygui (and gui modules)
+#define SUPPORT_FRAME_PROFILER
+#if defined(RGUIICONS_CLI_ONLY)
+    #undef SUPPORT_FRAME_PROFILER           // Command-line only build, no frames to profile
+#endif
+
+#if defined(SUPPORT_FRAME_PROFILER)
+static int profileDrawCalls = 0;            // Draw calls issued to raylib (shapes, text, textures), not GPU batches
+static int profileRectangles = 0;           // Rectangles drawn (filled, gradient, lines)
+
+#define DrawRectangle(...)              (profileDrawCalls++, profileRectangles++, DrawRectangle(__VA_ARGS__))
+#define DrawRectangleGradientV(...)     (profileDrawCalls++, profileRectangles++, DrawRectangleGradientV(__VA_ARGS__))
+#define DrawRectangleGradientEx(...)    (profileDrawCalls++, profileRectangles++, DrawRectangleGradientEx(__VA_ARGS__))
+#define DrawRectangleLinesEx(...)       (profileDrawCalls++, profileRectangles++, DrawRectangleLinesEx(__VA_ARGS__))
+#define DrawTriangle(...)               (profileDrawCalls++, DrawTriangle(__VA_ARGS__))
+#define DrawText(...)                   (profileDrawCalls++, DrawText(__VA_ARGS__))
+#define DrawTextEx(...)                 (profileDrawCalls++, DrawTextEx(__VA_ARGS__))
+#define DrawTextCodepoint(...)          (profileDrawCalls++, DrawTextCodepoint(__VA_ARGS__))
+#define DrawTextureRec(...)             (profileDrawCalls++, DrawTextureRec(__VA_ARGS__))
+#define DrawTexturePro(...)             (profileDrawCalls++, DrawTexturePro(__VA_ARGS__))
+#endif
+
 // NOTE: Some raygui elements need to be defined before including raygui
 #define RAYGUI_TEXTSPLIT_MAX_ITEMS        256
 #define RAYGUI_TEXTSPLIT_MAX_TEXT_SIZE   4096
 #define RAYGUI_TOGGLEGROUP_MAX_ITEMS      256
 #define RAYGUI_GRID_ALPHA                 0.2f
+#if defined(RGUIICONS_CLI_ONLY)
+    // NOTE: Standalone raygui, rpng internal deflate and backend define some functions not
+    // used by command-line only build, unused functions not reported for those headers
+    #if defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wunused-function"
+    #endif
+    #include "cli_backend.h"                // Command-line only backend, required before raygui implementation
+#endif
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"                         // Required for: IMGUI controls
 
 #undef RAYGUI_IMPLEMENTATION                // Avoid including raygui implementation again
 
+#if !defined(RGUIICONS_CLI_ONLY)
 #define GUI_MAIN_TOOLBAR_IMPLEMENTATION
 #include "gui_main_toolbar.h"               // GUI: Main toolbar
 
@@ -138,12 +219,21 @@
 #define GUI_WINDOW_ABOUT_IMPLEMENTATION
 #include "gui_window_about.h"               // GUI: About Window
 
+#if defined(PLATFORM_DESKTOP)
+#define WORKER_THREAD_IMPLEMENTATION
+#include "worker_thread.h"                  // Worker threads: file dialogs, styles loading, autosave
+#undef WORKER_THREAD_IMPLEMENTATION         // Avoid including worker thread implementation again
+#endif
+
 #define GUI_FILE_DIALOGS_IMPLEMENTATION
 #include "gui_file_dialogs.h"               // GUI: File Dialogs
 
 // raygui embedded styles
-// NOTE: Included in the same order as selector
+// NOTE: Included in the same order as selector, styles font atlas decompression is
+// redirected to get the data already decompressed on background (if available)
 #define MAX_GUI_STYLES_AVAILABLE   14       // NOTE: Included light style
+static unsigned char *DecompressStyleFontData(const unsigned char *compData, int compDataSize, int *dataSize);
+#define DecompressData(compData, compDataSize, dataSize) DecompressStyleFontData(compData, compDataSize, dataSize)
 #include "styles/style_jungle.h"            // raygui style: jungle
 #include "styles/style_candy.h"             // raygui style: candy
 #include "styles/style_lavanda.h"           // raygui style: lavanda
@@ -157,14 +247,35 @@
 #include "styles/style_enefete.h"           // raygui style: enefete
 #include "styles/style_amber.h"             // raygui style: amber
 #include "styles/style_genesis.h"           // raygui style: genesis
+#undef DecompressData
+#endif  // !RGUIICONS_CLI_ONLY
 
 #define RPNG_IMPLEMENTATION
+#if defined(RGUIICONS_CLI_ONLY)
+    #define RPNG_DEFLATE_IMPLEMENTATION     // Compression functions usually provided by raylib
+    #define RPNG_DEFLATE_THREADS    4       // Parallel deflate for big PNG image data (internal sdefl required)
+#endif
 #include "external/rpng.h"                  // PNG chunks management
 
+#if defined(RGUIICONS_CLI_ONLY) && defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+#define ICONSET_IMPLEMENTATION
+#include "iconset.h"                        // Iconset data load/save/export
+
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
 #include <stdlib.h>                         // Required for: malloc(), free()
 #include <string.h>                         // Required for: strcmp(), strlen()
 #include <stdio.h>                          // Required for: FILE, fopen(), fread(), fwrite(), ftell(), fseek() fclose()
+#include <time.h>                           // Required for: clock()
+#include <ctype.h>                          // Required for: toupper()
+#include <limits.h>                         // Required for: INT_MAX
+
+#if defined(PLATFORM_DESKTOP) && defined(_WIN32)
+    #include <io.h>                         // Required for: _setmode(), _fileno()
+    #include <fcntl.h>                      // Required for: _O_BINARY
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -182,9 +293,93 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
     #define LOG(...)
 #endif
 
-#define RGI_BIT_CHECK(a,b)  ((a) &  (1u<<(b)))
-#define RGI_BIT_SET(a,b)    ((a) |= (1u<<(b)))
-#define RGI_BIT_CLEAR(a,b)  ((a) &= ~((1u)<<(b)))
+// Decompress styles font atlas on background threads
+#define SUPPORT_STYLES_BACKGROUND_LOADING
+#if !defined(PLATFORM_DESKTOP) || defined(RGUIICONS_CLI_ONLY)
+    #undef SUPPORT_STYLES_BACKGROUND_LOADING
+#endif
+
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+    #define MAX_STYLES_LOADING_THREADS  4   // Threads used to decompress styles font atlas
+#endif
+
+// Skip screen redraw and wait for events when idle
+#define SUPPORT_IDLE_EVENT_WAITING
+#if defined(PLATFORM_WEB) || defined(RGUIICONS_CLI_ONLY)
+    #undef SUPPORT_IDLE_EVENT_WAITING
+#endif
+
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+    #define REDRAW_FRAMES_ON_CHANGE     2   // Frames redrawn after a change, controls state requires one extra frame to settle
+#endif
+
+#if defined(SUPPORT_FRAME_PROFILER)
+    #define PROFILER_AVERAGE_FRAMES     30  // Frames averaged for overlay timings (refreshed every N frames)
+
+    #define PROFILE_BEGIN(section)      ProfileBegin(section)
+    #define PROFILE_END(section)        ProfileEnd(section)
+#else
+    #define PROFILE_BEGIN(section)
+    #define PROFILE_END(section)
+#endif
+
+// Watch directory for iconsets changes and reconvert them (command-line)
+#define SUPPORT_WATCH_MODE
+#if !defined(PLATFORM_DESKTOP) || !defined(__linux__)
+    #undef SUPPORT_WATCH_MODE
+#endif
+
+#if defined(SUPPORT_WATCH_MODE)
+    #include <sys/inotify.h>    // Required for: inotify_init1(), inotify_add_watch()
+    #include <poll.h>           // Required for: poll()
+    #include <unistd.h>         // Required for: read(), close()
+    #include <time.h>           // Required for: clock_gettime()
+    #include <errno.h>          // Required for: errno, EINTR
+
+    #define WATCH_DEBOUNCE_TIME         100     // Time without new writes before reconverting changed files (ms)
+    #define WATCH_MAX_PENDING_FILES      64     // Changed files pending reconversion, converted immediately if exceeded
+#endif
+
+// Journal loaded iconset changes for crash recovery
+#define SUPPORT_ICONS_JOURNAL
+#if !defined(PLATFORM_DESKTOP) || defined(RGUIICONS_CLI_ONLY)
+    #undef SUPPORT_ICONS_JOURNAL
+#endif
+
+#if defined(SUPPORT_ICONS_JOURNAL)
+    #define ICONS_JOURNAL_MAX_RECORDS   1024    // Records appended before journal is compacted (one record per changed icon)
+#endif
+
+// Save loaded iconset changes periodically on background thread
+#define SUPPORT_ICONS_AUTOSAVE
+#if !defined(PLATFORM_DESKTOP) || defined(RGUIICONS_CLI_ONLY)
+    #undef SUPPORT_ICONS_AUTOSAVE
+#endif
+
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+    #define ICONS_AUTOSAVE_INTERVAL     30.0    // Time between iconset autosaves, if changes pending (seconds)
+#endif
+
+// Population count (set bits) of 32-bit value, used for icons distance
+#if defined(_MSC_VER)
+    #include <intrin.h>         // Required for: __popcnt()
+    #define ICON_POPCOUNT(x)    ((int)__popcnt(x))
+#elif defined(__GNUC__) || defined(__clang__)
+    #define ICON_POPCOUNT(x)    __builtin_popcount(x)
+#else
+    #define ICON_POPCOUNT(x)    PopCount(x)
+#endif
+
+#define SIMILAR_ICONS_COUNT     8       // Similar icons shown/reported for selected icon
+
+#define MAX_OUTPUT_FILES        16      // Output files generated from one input file (command-line)
+
+#define ICONS_NAME_INDEX_BUCKETS    512                         // Name ids hash table buckets (power of 2)
+#define ICONS_NAME_INDEX_MAX_WORDS  (RAYGUI_ICON_MAX_ICONS*16)  // Name ids words indexed, up to 16 words per name id
+
+// Icon pixels mask, one unsigned int per icon row (RAYGUI_ICON_SIZE lower bits used)
+#define ICON_ROWS_PER_ELEMENT   ((int)(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE))
+#define ICON_ROW_BITS           ((RAYGUI_ICON_SIZE >= 32)? 0xffffffffu : ((1u << RAYGUI_ICON_SIZE) - 1))
 
 #define MAX_UNDO_LEVELS         10      // Undo levels supported for the ring buffer
 
@@ -211,6 +406,187 @@ typedef struct GuiIconSet {
     unsigned int *values;
 } GuiIconSet;
 
+// Icons content index, one 64-bit content hash per icon
+// NOTE: Updated incrementally, only icons changed since last update are hashed again
+typedef struct IconsIndex {
+    unsigned long long hashes[RAYGUI_ICON_MAX_ICONS];       // Icons content hash
+    unsigned int indexedIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS]; // Icons data at last update, used to detect changes
+    int duplicateOf[RAYGUI_ICON_MAX_ICONS];                 // First icon with same content, -1 if unique (or empty)
+    int duplicateCount;                                     // Icons with same content than a previous icon
+    bool initialized;                                       // Index initialized, all icons hashed
+} IconsIndex;
+
+// Icon name id word, name id start or character after '_' separator
+typedef struct IconNameWord {
+    short iconId;               // Icon position in iconset
+    short offset;               // Word start position in icon name id
+} IconNameWord;
+
+// Icons name ids index: hash table for name id lookup, sorted words for filtering by prefix
+// NOTE: Name ids compared case-insensitive, unnamed icons are not indexed
+typedef struct IconsNameIndex {
+    char indexedNames[RAYGUI_ICON_MAX_ICONS][RAYGUI_ICON_MAX_NAME_LENGTH]; // Name ids at last update, used to detect changes
+    unsigned int hashes[RAYGUI_ICON_MAX_ICONS];             // Name ids hash
+    int buckets[ICONS_NAME_INDEX_BUCKETS];                  // First icon on every hash bucket, -1 if empty
+    int nextInBucket[RAYGUI_ICON_MAX_ICONS];                // Next icon on same hash bucket, -1 if last
+    IconNameWord words[ICONS_NAME_INDEX_MAX_WORDS];         // Name ids words, sorted alphabetically
+    int wordCount;                                          // Name ids words indexed
+    bool initialized;                                       // Index initialized, all name ids indexed
+} IconsNameIndex;
+
+// Icons BK-tree node, one icon per node
+// NOTE: Children are linked as a siblings list, every child at a different distance from parent
+typedef struct IconsTreeNode {
+    int entry;                  // Icon index in tree icons data
+    int distance;               // Distance to parent node
+    int firstChild;             // First child node index, -1 if none
+    int nextSibling;            // Next sibling node index, -1 if none
+} IconsTreeNode;
+
+// Icons BK-tree for similarity search, Hamming distance (XOR + popcount) as metric
+// NOTE: Empty icons are not added to the tree
+typedef struct IconsTree {
+    const unsigned int *icons;  // Icons data (RAYGUI_ICON_DATA_ELEMENTS per icon), not owned by tree
+    IconsTreeNode *nodes;       // Tree nodes, first one is root
+    int nodeCount;              // Tree nodes count
+} IconsTree;
+
+// Icons similarity search result
+typedef struct IconMatch {
+    int entry;                  // Icon index in tree icons data
+    int distance;               // Different pixels to searched icon
+} IconMatch;
+
+// Icon entry for duplicates report across iconsets (command-line --dedupe)
+typedef struct IconEntry {
+    unsigned long long hash;                        // Icon content hash
+    unsigned int data[RAYGUI_ICON_DATA_ELEMENTS];   // Icon data, hash collisions resolved by data
+    char name[RAYGUI_ICON_MAX_NAME_LENGTH];         // Icon name id
+    int fileIndex;                                  // Iconset file index
+    int iconId;                                     // Icon position in iconset
+} IconEntry;
+
+// Icon edition tools
+// NOTE: Shape and fill tools are applied on mouse release, one undo step per operation
+typedef enum {
+    EDIT_TOOL_PENCIL = 0,       // Paint/erase pixels while mouse button down
+    EDIT_TOOL_LINE,             // Line between press and release cells
+    EDIT_TOOL_RECTANGLE,        // Rectangle outline, press and release cells as corners
+    EDIT_TOOL_ELLIPSE,          // Ellipse outline, inscribed in press and release cells rectangle
+    EDIT_TOOL_FILL,             // Flood fill, connected pixels with same value than pressed cell
+} EditTool;
+
+// Output file formats, can be combined as flags
+typedef enum {
+    OUTPUT_FORMAT_RGI  = 1,     // raygui icons file (.rgi)
+    OUTPUT_FORMAT_PNG  = 2,     // 1-bit image with icons name ids (.png)
+    OUTPUT_FORMAT_CODE = 4,     // Icons data as code (.h)
+} OutputFormat;
+
+// Frame profiler sections
+// NOTE: A section can be timed multiple times per frame, times are accumulated
+typedef enum {
+    PROFILE_FRAME = 0,          // Full frame: logic, drawing and present (frame wait not included)
+    PROFILE_UNDO,               // Undo/redo logic
+    PROFILE_INPUT,              // Dropped files and keyboard shortcuts logic
+    PROFILE_TOOLBAR,            // Main toolbar drawing
+    PROFILE_TOGGLEGROUP,        // Icons selection toggle group drawing
+    PROFILE_DRAWICON,           // Selected icon drawing at edit scale
+    PROFILE_GRID,               // Edit grid drawing
+    PROFILE_WINDOWS,            // Windows and dialogs drawing
+    PROFILE_PRESENT,            // Render texture drawing to screen
+    PROFILE_SECTION_COUNT
+} ProfileSection;
+
+// Frame profiler section stats
+typedef struct ProfileSectionStats {
+    double time;                // Section time on current frame (seconds)
+    double timeSum;             // Section time accumulated for average
+    double timeAverage;         // Section time average (shown on overlay)
+    int drawCalls;              // Draw calls issued on current frame
+    int rectangles;             // Rectangles drawn on current frame
+} ProfileSectionStats;
+
+// Frame profiler
+typedef struct FrameProfiler {
+    bool active;                // Profiler overlay shown
+    FILE *traceFile;            // Trace output file (.csv), NULL if not tracing
+    unsigned int frameIndex;    // Current frame index
+    int averageFrames;          // Drawn frames accumulated for average
+    double sectionStartTime[PROFILE_SECTION_COUNT];     // Section start time
+    int sectionStartDrawCalls[PROFILE_SECTION_COUNT];   // Section start draw calls counter
+    int sectionStartRectangles[PROFILE_SECTION_COUNT];  // Section start rectangles counter
+    ProfileSectionStats sections[PROFILE_SECTION_COUNT];
+} FrameProfiler;
+
+// Visual style, decoded once and cached
+// NOTE: Font texture is kept resident in GPU memory,
+// style switching just restores properties and font
+typedef struct VisualStyle {
+    bool loaded;                // Style already decoded and cached
+    int props[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)]; // Style properties values
+    Font font;                  // Style font (texture uploaded once)
+    Rectangle shapesRec;        // Style font white rectangle, used for shapes drawing
+} VisualStyle;
+
+// Style font atlas data, decompressed on background
+// NOTE: Data is handed over to style loading when requested
+typedef struct StyleFontData {
+    const unsigned char *compData;  // Compressed font atlas data (embedded in style)
+    int compDataSize;               // Compressed font atlas data size
+    unsigned char *data;            // Decompressed font atlas data
+    int dataSize;                   // Decompressed font atlas data size
+} StyleFontData;
+
+#if defined(SUPPORT_ICONS_JOURNAL)
+// Icons journal file header
+// NOTE: Journal is only valid for the iconset file it was created from (checksum)
+typedef struct IconsJournalHeader {
+    char signature[4];              // Signature: "rGIJ"
+    short version;                  // Version: 100
+    short reserved;                 // Reserved
+    unsigned int baseChecksum;      // Iconset file checksum
+} IconsJournalHeader;
+
+// Icons journal record, one changed icon (data and name id)
+typedef struct IconsJournalRecord {
+    unsigned int sequence;          // Record sequence number, starting at 1
+    unsigned short iconId;          // Icon id
+    unsigned short reserved;        // Reserved
+    unsigned int data[RAYGUI_ICON_DATA_ELEMENTS];   // Icon data
+    char name[RAYGUI_ICON_MAX_NAME_LENGTH];         // Icon name id
+    unsigned int checksum;          // Record checksum (previous fields), torn records detection
+} IconsJournalRecord;
+
+// Icons journal, loaded iconset changes
+typedef struct IconsJournal {
+    FILE *file;                     // Journal file, opened for appending
+    char fileName[512 + 8];         // Journal file name (<file>.rgi.journal)
+    char iconsFileName[512];        // Iconset file name
+    unsigned int baseChecksum;      // Iconset file checksum
+    unsigned int sequence;          // Last record sequence number
+    int recordCount;                // Records written since last compaction
+    unsigned int icons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS];    // Journaled icons data
+    char names[RAYGUI_ICON_MAX_ICONS][RAYGUI_ICON_MAX_NAME_LENGTH];         // Journaled icons name id
+    unsigned int baseIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS]; // Iconset file icons data
+    char baseNames[RAYGUI_ICON_MAX_ICONS][RAYGUI_ICON_MAX_NAME_LENGTH];      // Iconset file icons name id
+} IconsJournal;
+#endif
+
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+// Icons autosave, iconset snapshot saved by worker thread
+// NOTE: Snapshot is only accessed by worker thread while running, changed icons copied on start
+typedef struct IconsAutosave {
+    bool running;                   // Autosave running, result not processed yet (main thread only)
+    WorkerThread worker;            // Autosave worker thread, joined once finished
+    bool saved;                     // Snapshot saved successfully, written by worker thread
+    double time;                    // Last autosave start time
+    char fileName[512];             // Iconset file name
+    unsigned int icons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS];    // Icons data snapshot
+    char names[RAYGUI_ICON_MAX_ICONS][RAYGUI_ICON_MAX_NAME_LENGTH];         // Icons name id snapshot
+} IconsAutosave;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -220,252 +596,62 @@ static const char *toolDescription = TOOL_DESCRIPTION;
 
 // NOTE: Max length depends on OS, in Windows MAX_PATH = 256
 static char inFileName[512] = { 0 };        // Input file name (required in case of drag & drop over executable)
+#if !defined(RGUIICONS_CLI_ONLY)
 static char outFileName[512] = { 0 };       // Output file name (required for file save/export)
 
 static bool saveChangesRequired = false;    // Flag to notice save changes are required
+#endif
+
+#if defined(SUPPORT_FRAME_PROFILER)
+static FrameProfiler profiler = { 0 };      // Frame profiler (overlay and trace)
 
-// Icons name id text
-static char guiIconsName[RAYGUI_ICON_MAX_ICONS][32] = {
-    "NONE",
-    "FOLDER_FILE_OPEN",
-    "FILE_SAVE_CLASSIC",
-    "FOLDER_OPEN",
-    "FOLDER_SAVE",
-    "FILE_OPEN",
-    "FILE_SAVE",
-    "FILE_EXPORT",
-    "FILE_ADD",
-    "FILE_DELETE",
-    "FILETYPE_TEXT",
-    "FILETYPE_AUDIO",
-    "FILETYPE_IMAGE",
-    "FILETYPE_PLAY",
-    "FILETYPE_VIDEO",
-    "FILETYPE_INFO",
-    "FILE_COPY",
-    "FILE_CUT",
-    "FILE_PASTE",
-    "CURSOR_HAND",
-    "CURSOR_POINTER",
-    "CURSOR_CLASSIC",
-    "PENCIL",
-    "PENCIL_BIG",
-    "BRUSH_CLASSIC",
-    "BRUSH_PAINTER",
-    "WATER_DROP",
-    "COLOR_PICKER",
-    "RUBBER",
-    "COLOR_BUCKET",
-    "TEXT_T",
-    "TEXT_A",
-    "SCALE",
-    "RESIZE",
-    "FILTER_POINT",
-    "FILTER_BILINEAR",
-    "CROP",
-    "CROP_ALPHA",
-    "SQUARE_TOGGLE",
-    "SYMMETRY",
-    "SYMMETRY_HORIZONTAL",
-    "SYMMETRY_VERTICAL",
-    "LENS",
-    "LENS_BIG",
-    "EYE_ON",
-    "EYE_OFF",
-    "FILTER_TOP",
-    "FILTER",
-    "TARGET_POINT",
-    "TARGET_SMALL",
-    "TARGET_BIG",
-    "TARGET_MOVE",
-    "CURSOR_MOVE",
-    "CURSOR_SCALE",
-    "CURSOR_SCALE_RIGHT",
-    "CURSOR_SCALE_LEFT",
-    "UNDO",
-    "REDO",
-    "REREDO",
-    "MUTATE",
-    "ROTATE",
-    "REPEAT",
-    "SHUFFLE",
-    "EMPTYBOX",
-    "TARGET",
-    "TARGET_SMALL_FILL",
-    "TARGET_BIG_FILL",
-    "TARGET_MOVE_FILL",
-    "CURSOR_MOVE_FILL",
-    "CURSOR_SCALE_FILL",
-    "CURSOR_SCALE_RIGHT_FILL",
-    "CURSOR_SCALE_LEFT_FILL",
-    "UNDO_FILL",
-    "REDO_FILL",
-    "REREDO_FILL",
-    "MUTATE_FILL",
-    "ROTATE_FILL",
-    "REPEAT_FILL",
-    "SHUFFLE_FILL",
-    "EMPTYBOX_SMALL",
-    "BOX",
-    "BOX_TOP",
-    "BOX_TOP_RIGHT",
-    "BOX_RIGHT",
-    "BOX_BOTTOM_RIGHT",
-    "BOX_BOTTOM",
-    "BOX_BOTTOM_LEFT",
-    "BOX_LEFT",
-    "BOX_TOP_LEFT",
-    "BOX_CENTER",
-    "BOX_CIRCLE_MASK",
-    "POT",
-    "ALPHA_MULTIPLY",
-    "ALPHA_CLEAR",
-    "DITHERING",
-    "MIPMAPS",
-    "BOX_GRID",
-    "GRID",
-    "BOX_CORNERS_SMALL",
-    "BOX_CORNERS_BIG",
-    "FOUR_BOXES",
-    "GRID_FILL",
-    "BOX_MULTISIZE",
-    "ZOOM_SMALL",
-    "ZOOM_MEDIUM",
-    "ZOOM_BIG",
-    "ZOOM_ALL",
-    "ZOOM_CENTER",
-    "BOX_DOTS_SMALL",
-    "BOX_DOTS_BIG",
-    "BOX_CONCENTRIC",
-    "BOX_GRID_BIG",
-    "OK_TICK",
-    "CROSS",
-    "ARROW_LEFT",
-    "ARROW_RIGHT",
-    "ARROW_DOWN",
-    "ARROW_UP",
-    "ARROW_LEFT_FILL",
-    "ARROW_RIGHT_FILL",
-    "ARROW_DOWN_FILL",
-    "ARROW_UP_FILL",
-    "AUDIO",
-    "FX",
-    "WAVE",
-    "WAVE_SINUS",
-    "WAVE_SQUARE",
-    "WAVE_TRIANGULAR",
-    "CROSS_SMALL",
-    "PLAYER_PREVIOUS",
-    "PLAYER_PLAY_BACK",
-    "PLAYER_PLAY",
-    "PLAYER_PAUSE",
-    "PLAYER_STOP",
-    "PLAYER_NEXT",
-    "PLAYER_RECORD",
-    "MAGNET",
-    "LOCK_CLOSE",
-    "LOCK_OPEN",
-    "CLOCK",
-    "TOOLS",
-    "GEAR",
-    "GEAR_BIG",
-    "BIN",
-    "HAND_POINTER",
-    "LASER",
-    "COIN",
-    "EXPLOSION",
-    "1UP",
-    "PLAYER",
-    "PLAYER_JUMP",
-    "KEY",
-    "DEMON",
-    "TEXT_POPUP",
-    "GEAR_EX",
-    "CRACK",
-    "CRACK_POINTS",
-    "STAR",
-    "DOOR",
-    "EXIT",
-    "MODE_2D",
-    "MODE_3D",
-    "CUBE",
-    "CUBE_FACE_TOP",
-    "CUBE_FACE_LEFT",
-    "CUBE_FACE_FRONT",
-    "CUBE_FACE_BOTTOM",
-    "CUBE_FACE_RIGHT",
-    "CUBE_FACE_BACK",
-    "CAMERA",
-    "SPECIAL",
-    "LINK_NET",
-    "LINK_BOXES",
-    "LINK_MULTI",
-    "LINK",
-    "LINK_BROKE",
-    "TEXT_NOTES",
-    "NOTEBOOK",
-    "SUITCASE",
-    "SUITCASE_ZIP",
-    "MAILBOX",
-    "MONITOR",
-    "PRINTER",
-    "PHOTO_CAMERA",
-    "PHOTO_CAMERA_FLASH",
-    "HOUSE",
-    "HEART",
-    "CORNER",
-    "VERTICAL_BARS",
-    "VERTICAL_BARS_FILL",
-    "LIFE_BARS",
-    "INFO",
-    "CROSSLINE",
-    "HELP",
-    "FILETYPE_ALPHA",
-    "FILETYPE_HOME",
-    "LAYERS_VISIBLE",
-    "LAYERS",
-    "WINDOW",
-    "HIDPI",
-    "FILETYPE_BINARY",
-    "HEX",
-    "SHIELD",
-    "FILE_NEW",
-    "FOLDER_ADD",
-    "ALARM",
-    "CPU",
-    "ROM",
-    "STEP_OVER",
-    "STEP_INTO",
-    "STEP_OUT",
-    "RESTART",
-    "BREAKPOINT_ON",
-    "BREAKPOINT_OFF",
-    "BURGER_MENU",
-    "CASE_SENSITIVE",
-    "REG_EXP",
-    "FOLDER",
-    "FILE",
-    "TEMPO",
-    "WARNING",
-    "HELP_BOX",
-    "INFO_BOX",
-    "PRIORITY",
-    "LAYERS_ISO",
-    "LAYERS2",
-    "MLAYERS",
-    "MAPS",
-    "HOT",
-    "LABEL",
-    "NAME_ID",
-    "SLICING",
-    "MANUAL_CONTROL",
-    "COLLISION",
+static const char *profileSectionNames[PROFILE_SECTION_COUNT] = {
+    "frame", "undo", "input", "toolbar", "togglegroup", "drawicon", "grid", "windows", "present"
 };
+#endif
 
+#if !defined(RGUIICONS_CLI_ONLY)
 // Keep a pointer to original gui iconset as backup
 static unsigned int *backupGuiIcons = guiIcons;
-static unsigned int currentIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
+
 static char backupGuiIconsName[RAYGUI_ICON_MAX_ICONS][32] = { 0 };
+static char checkedIconsName[RAYGUI_ICON_MAX_ICONS][32] = { 0 };    // Icons name ids on last changes check (undo and journal)
+
+static IconsIndex iconsIndex = { 0 };                               // Current icons content index (duplicates detection)
+static IconsNameIndex iconsNameIndex = { 0 };                       // Current icons name ids index (name lookup and filtering)
+#if defined(SUPPORT_ICONS_JOURNAL)
+static IconsJournal iconsJournal = { 0 };                           // Loaded iconset changes journal (crash recovery)
+#endif
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+static IconsAutosave iconsAutosave = { 0 };                         // Loaded iconset autosave (background)
+#endif
+
+static VisualStyle visualStyles[MAX_GUI_STYLES_AVAILABLE] = { 0 };  // Visual styles cache
+
+// Styles font atlas data, decompressed on background threads
+// NOTE: Same order as visual styles, default style (0) has no font atlas
+static StyleFontData stylesFontData[MAX_GUI_STYLES_AVAILABLE] = {
+    { 0 },
+    { jungleFontData, JUNGLE_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { candyFontData, CANDY_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { lavandaFontData, LAVANDA_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { cyberFontData, CYBER_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { terminalFontData, TERMINAL_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { ashesFontData, ASHES_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { bluishFontData, BLUISH_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { darkFontData, DARK_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { cherryFontData, CHERRY_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { sunnyFontData, SUNNY_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { enefeteFontData, ENEFETE_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { amberFontData, AMBER_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+    { genesisFontData, GENESIS_STYLE_FONT_ATLAS_COMP_SIZE, NULL, 0 },
+};
+#endif
+
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+static WorkerThread stylesLoadingThreads[MAX_STYLES_LOADING_THREADS] = { 0 };
+static int stylesLoadingThreadCount = 0;    // Styles loading threads running (not joined yet)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
@@ -473,27 +659,104 @@ static char backupGuiIconsName[RAYGUI_ICON_MAX_ICONS][32] = { 0 };
 #if defined(PLATFORM_DESKTOP)
 // Command line functionality
 static void ShowCommandLineInfo(void);                      // Show command line usage info
-static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static int ProcessCommandLine(int argc, char *argv[]);      // Process command line input, returns exit status
+static void ReportDuplicateIcons(char **fileNames, int fileCount); // Report duplicate icons across multiple iconsets (.rgi)
+static int CompareIconEntries(const void *a, const void *b);  // Compare icon entries by hash and data (qsort)
+static void ReportSimilarIcons(char **fileNames, int fileCount, int iconId); // Report icons similar to one icon, across multiple iconsets (.rgi)
+static void ReportIconsByName(const char *name, char **fileNames, int fileCount); // Report icons found by name id, default iconset if no files provided
+static int ParseOutputFormats(const char *formats, FILE *info, int *firstFormat); // Parse output formats list (i.e. "png,h"), returns OutputFormat flags
+static int ExportIconsFile(const char *fileName);           // Export icons to file, format defined by extension (.rgi, .png, .h)
+static int ExportIconsToStream(FILE *stream, int format);   // Export icons to stream (i.e. stdout), OutputFormat provided
+static unsigned char *LoadStreamData(FILE *stream, int *dataSize); // Load stream data until end (i.e. stdin), memory must be freed
+#if defined(SUPPORT_WATCH_MODE)
+static void WatchIconsDirectory(const char *dirPath, int formats); // Watch directory .rgi files, changed files reconverted
+static long long GetWatchTime(void);                        // Get monotonic time in milliseconds
+#endif
+#endif
+
+#if !defined(RGUIICONS_CLI_ONLY)
+// Visual styles functions
+static void LoadVisualStyle(int style);                     // Load visual style (decoded once, cached for next loads)
+static void CacheVisualStyle(int style);                    // Decode visual style into cache, current style is kept
+static void UnloadVisualStyles(void);                       // Unload all cached visual styles
+static void LoadStylesFontDataAsync(void);                  // Start styles font atlas decompression on background threads
+static void WaitStylesFontData(void);                       // Wait for styles font atlas decompression to finish
+#endif
+
+#if defined(SUPPORT_FRAME_PROFILER)
+// Frame profiler functions
+static void ProfileBegin(int section);                      // Begin section timing and counting
+static void ProfileEnd(int section);                        // End section timing and counting (accumulated)
+static void ProfileFrameBegin(void);                        // Begin frame profiling, current frame stats reset
+static void ProfileFrameEnd(bool drawn);                    // End frame profiling, stats averaged and traced
+static bool OpenProfilerTrace(const char *fileName);        // Open profiler trace file (.csv), header written
+static void CloseProfilerTrace(void);                       // Close profiler trace file
+static void DrawProfilerOverlay(void);                      // Draw profiler overlay
+#endif
+
+#if defined(SUPPORT_ICONS_JOURNAL)
+// Icons journal functions
+static int OpenIconsJournal(IconsJournal *journal, const char *fileName);       // Open icons journal for iconset file, returns replayed records count
+static int UpdateIconsJournal(IconsJournal *journal);                           // Update icons journal, returns changed icons count
+static void ResetIconsJournal(IconsJournal *journal, const char *fileName, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH]); // Reset icons journal, iconset file saved
+static void CloseIconsJournal(IconsJournal *journal, bool removeFile);          // Close icons journal, optionally removing journal file
+static bool CompactIconsJournal(IconsJournal *journal);                         // Compact icons journal, one record per changed icon
+static bool WriteIconsJournalRecord(IconsJournal *journal, int iconId);         // Write icons journal record, journaled icon state
+static unsigned int GetIconsFileChecksum(const char *fileName);                 // Get iconset file checksum, 0 if file can not be loaded
+static unsigned int ComputeJournalChecksum(const void *data, int size);         // Compute data checksum (FNV-1a, 32-bit)
 #endif
 
-// Load/Save/Export data functions
-static void LoadIconsFromImage(Image image, int iconCount, int iconSize, int iconsPerLine, int padding); // Load icons from image file
-static int SaveIcons(const char *fileName);                 // Save raygui icons file (.rgi)
-static void ExportIconsAsCode(const char *fileName);        // Export gui icons as code (.h)
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+// Icons autosave functions
+static bool StartIconsAutosave(const char *fileName);       // Start iconset autosave, changed icons copied to snapshot
+static bool SaveIconsAutosaveSnapshot(void);                // Save iconset autosave snapshot, temporary file renamed
+static bool IsIconsAutosaveFinished(void);                  // Check if iconset autosave worker thread finished (non blocking)
+static bool JoinIconsAutosave(void);                        // Join iconset autosave worker thread, returns true if saved
+static bool IsIconsAutosaveCurrent(void);                   // Check if iconset autosave snapshot matches current iconset
+#endif
 
 // Auxiliar functions
-static void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color); // Draw selected icon from iconset
-static void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color);                 // Draw one icon, icon data provided directly
-static Image GenImageFromIconData(unsigned int *values, int iconCount, int iconsPerLine, int padding);  // Gen icons pack image from icon data array
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+static bool IsInputEventDetected(void);                                                                 // Check if any input event happened on current frame
+#endif
+#if !defined(RGUIICONS_CLI_ONLY)
 static Image GenImageFromBits(unsigned char *bytes, int width, int height, Color color);                // Gen image from bits data (packed in bytes)
 static unsigned char *ImageToBits(Image image);                                                         // Gen bits array (packed in bytes) from image data
 
-static unsigned int *GetIconData(unsigned int *iconset, int iconId);             // Get icon bit data
-static void SetIconData(unsigned int *iconset, int iconId, unsigned int *data);  // Set icon bit data
-static void SetIconPixel(unsigned int *iconset, int iconId, int x, int y);       // Set icon pixel value
-static void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Clear icon pixel value
-static bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y);     // Check icon pixel value
+static void GenIconShapeMask(unsigned int *mask, int tool, int x0, int y0, int x1, int y1); // Gen icon pixels mask for shape tool (line, rectangle, ellipse)
+static void GenIconFillMask(unsigned int *mask, const unsigned int *data, int x, int y); // Gen icon pixels mask for flood fill (connected pixels with same value)
+static void ApplyIconMask(unsigned int *data, const unsigned int *mask, bool set);      // Set or clear icon data masked pixels
+static void SetMaskPixel(unsigned int *mask, int x, int y);                     // Set icon pixels mask pixel, out of icon pixels ignored
+
+static void UpdateIconsIndex(IconsIndex *index, const unsigned int *iconset);   // Update icons content index, changed icons hashed again
+#endif
+
+static unsigned long long HashIconData(const unsigned int *data);               // Get icon content hash (64-bit), 0 for empty icons
+
+static int GetIconsDistance(const unsigned int *icon1, const unsigned int *icon2); // Get icons distance: different pixels count (XOR + popcount)
+static IconsTree LoadIconsTree(const unsigned int *icons, int count);           // Load icons BK-tree for similarity search (icons data not copied)
+static void UnloadIconsTree(IconsTree tree);                                    // Unload icons BK-tree
+static int SearchIconsTree(IconsTree tree, const unsigned int *icon, int excludeEntry, IconMatch *matches, int maxMatches); // Search most similar icons, sorted by distance
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(_MSC_VER)
+static int PopCount(unsigned int value);                                         // Get set bits count (portable)
+#endif
 
+static int UpdateIconsNameIndex(IconsNameIndex *index, char names[][RAYGUI_ICON_MAX_NAME_LENGTH], int count); // Update icons name ids index (first count icons), returns changed name ids count
+static int FindIconByName(const IconsNameIndex *index, const char *name);        // Find icon by name id (case-insensitive), -1 if not found
+static int FilterIconsByName(const IconsNameIndex *index, const char *text, bool *matches); // Filter icons with a name id word starting with text, returns matches count
+static unsigned int HashIconName(const char *name);                             // Get icon name id hash (case-insensitive)
+static int CompareIconNames(const char *name1, const char *name2, bool prefix); // Compare icon name ids (case-insensitive), optionally only name1 length
+
+#if defined(RGUIICONS_CLI_ONLY)
+//------------------------------------------------------------------------------------
+// Program main entry point (command-line only build)
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // NOTE: No gui interface available, usage info shown if no arguments provided
+    return ProcessCommandLine(argc, argv);
+}
+#else
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -502,6 +765,9 @@ int main(int argc, char *argv[])
 #if !defined(_DEBUG)
     SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
 #endif
+#if defined(SUPPORT_FRAME_PROFILER)
+    char traceFileName[512] = { 0 };    // Profiler trace output file name (.csv)
+#endif
 #if defined(PLATFORM_DESKTOP)
     // Command-line usage mode
     //--------------------------------------------------------------------------------------
@@ -516,11 +782,14 @@ int main(int argc, char *argv[])
                 strcpy(inFileName, argv[1]);        // Read input filename to open with gui interface
             }
         }
-        else
+#if defined(SUPPORT_FRAME_PROFILER)
+        else if ((argc >= 3) && (strcmp(argv[1], "--trace") == 0))     // GUI mode with frame trace: --trace <filename.csv> [<filename.rgi>]
         {
-            ProcessCommandLine(argc, argv);
-            return 0;
+            strcpy(traceFileName, argv[2]);
+            if ((argc > 3) && IsFileExtension(argv[3], ".rgi")) strcpy(inFileName, argv[3]);
         }
+#endif
+        else return ProcessCommandLine(argc, argv);
     }
 #endif  // PLATFORM_DESKTOP
 #if (!defined(_DEBUG) && (defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)))
@@ -535,9 +804,22 @@ int main(int argc, char *argv[])
     const int screenWidth = 640;
     const int screenHeight = 428;
 
+    // Start styles font atlas decompression, overlapped with window initialization
+    LoadStylesFontDataAsync();
+
     InitWindow(screenWidth, screenHeight, TextFormat("%s v%s | %s", toolName, toolVersion, toolDescription));
+
+#if defined(PLATFORM_DESKTOP) && !defined(CUSTOM_MODAL_DIALOGS)
+    // Native file dialogs backends probed on background, first dialog shown without delay
+    GuiFileDialogPreload();
+#endif
+
     SetExitKey(0);
 
+#if defined(SUPPORT_FRAME_PROFILER)
+    if ((traceFileName[0] != '\0') && !OpenProfilerTrace(traceFileName)) printf("WARNING: Profiler trace file could not be opened: %s\n", traceFileName);
+#endif
+
     // Create a RenderTexture2D to be used for render to texture
     RenderTexture2D target = LoadRenderTexture(screenWidth, screenHeight);
     SetTextureFilter(target.texture, TEXTURE_FILTER_POINT);
@@ -545,10 +827,26 @@ int main(int argc, char *argv[])
     Vector2 cell = { -1, -1 };  // Grid cell mouse position
     int iconEditScale = 16;     // Icon edit scale
 
+    // Icon edition tools
+    int editToolActive = EDIT_TOOL_PENCIL;  // Edition tool selected
+    bool shapeEditing = false;              // Shape/fill tool operation in progress (mouse button down)
+    bool shapeSetPixels = true;             // Shape/fill sets pixels (left button) or clears them (right button)
+    Vector2 shapeStartCell = { 0 };         // Shape first cell (mouse pressed)
+    Vector2 shapeEndCell = { 0 };           // Shape last cell (mouse position)
+    unsigned int shapeMask[RAYGUI_ICON_SIZE] = { 0 };                   // Shape/fill pixels mask, one unsigned int per row
+    unsigned int shapePreview[RAYGUI_ICON_DATA_ELEMENTS] = { 0 };       // Selected icon with shape applied, drawn while editing
+    Vector2 strokeLastCell = { -1, -1 };    // Pencil stroke cell painted on previous frame, -1 if no stroke in progress
+
     // GUI: Main layout
     //-----------------------------------------------------------------------------------
     Vector2 anchor01 = { 0, 0 };
     bool iconNameIdEditMode = false;
+
+    char iconsFilterText[RAYGUI_ICON_MAX_NAME_LENGTH] = { 0 };         // Icons filter by name id text box
+    char prevIconsFilterText[RAYGUI_ICON_MAX_NAME_LENGTH] = { 0 };     // Icons filter text at last filtering, used to detect changes
+    bool iconsFilterEditMode = false;
+    bool iconsFilterMatches[RAYGUI_ICON_MAX_ICONS] = { 0 };             // Icons matching filter
+    int iconsFilterCount = 0;
     int selectedIcon = 0;
 
     // ToggleGroup() text
@@ -587,6 +885,14 @@ int main(int argc, char *argv[])
     bool showIssueReportWindow = false;
     //-----------------------------------------------------------------------------------
 
+    // GUI: Similar Icons Window
+    //-----------------------------------------------------------------------------------
+    bool showSimilarIconsWindow = false;
+
+    IconMatch similarIcons[SIMILAR_ICONS_COUNT] = { 0 };    // Icons most similar to selected icon
+    int similarIconsCount = 0;
+    //-----------------------------------------------------------------------------------
+
     // GUI: Export Window
     //-----------------------------------------------------------------------------------
     bool showExportWindow = false;
@@ -648,7 +954,36 @@ int main(int argc, char *argv[])
         memcpy(undoIconSet[i].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
     }
 
+    memcpy(checkedIconsName, guiIconsName, sizeof(checkedIconsName));
+
+#if defined(SUPPORT_ICONS_JOURNAL)
+    // Recover unsaved changes from icons journal (if available)
+    // NOTE: Undo system keeps iconset file state, recovered changes can be undone
+    if ((inFileName[0] != '\0') && (IsFileExtension(inFileName, ".rgi")) && (OpenIconsJournal(&iconsJournal, inFileName) > 0))
+    {
+        SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
+        saveChangesRequired = true;
+    }
+#endif
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+    iconsAutosave.time = GetTime();     // First autosave after interval since iconset loaded
+#endif
+
     int styleFrameCounter = 0;
+    int stylePreloadIndex = 1;      // Next visual style to be cached on background loading
+
+    // Screen redraw variables
+    // NOTE: Screen is rendered to texture only when something changed,
+    // last render texture is re-presented on idle frames
+    int redrawFramesCounter = 1;
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+    bool inputDetected = false;
+    bool eventWaiting = false;
+    bool windowFocused = IsWindowFocused();
+    int drawnVisualStyle = mainToolbarState.visualStyleActive;
+    unsigned int *drawnIcons = (unsigned int *)calloc(RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+    memcpy(drawnIcons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+#endif
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -660,12 +995,24 @@ int main(int argc, char *argv[])
         // it contains the call to emscripten_sleep() for PLATFORM_WEB
         if (WindowShouldClose()) showExitWindow = true;
 
+#if defined(SUPPORT_FRAME_PROFILER)
+        ProfileFrameBegin();
+#endif
+
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+        // NOTE: Checked before any logic, dropped files are unloaded once processed
+        inputDetected = IsInputEventDetected();
+#endif
+
         // Undo icons change logic
         //----------------------------------------------------------------------------------
+        PROFILE_BEGIN(PROFILE_UNDO);
+
         // Make sure no windows are open to store changes
         if (!windowHelpState.windowActive &&
             !windowAboutState.windowActive &&
             !showIssueReportWindow &&
+            !showSimilarIconsWindow &&
             !showExitWindow &&
             !showLoadFileDialog &&
             !showSaveFileDialog &&
@@ -696,11 +1043,36 @@ int main(int argc, char *argv[])
                     }
                 }
 
+            #if defined(SUPPORT_ICONS_JOURNAL)
+                // Journal changed icons (data or name id) since last check
+                UpdateIconsJournal(&iconsJournal);
+            #endif
+                memcpy(checkedIconsName, guiIconsName, sizeof(checkedIconsName));
+
                 undoFrameCounter = 0;
             }
         }
         else undoFrameCounter = 120;
 
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+        // Autosave finished, save mark only cleared if iconset not changed since snapshot
+        if (iconsAutosave.running && IsIconsAutosaveFinished() && JoinIconsAutosave() && (strcmp(iconsAutosave.fileName, inFileName) == 0))
+        {
+        #if defined(SUPPORT_ICONS_JOURNAL)
+            ResetIconsJournal(&iconsJournal, iconsAutosave.fileName, iconsAutosave.icons, iconsAutosave.names);
+        #endif
+            if (saveChangesRequired && IsIconsAutosaveCurrent())
+            {
+                SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                saveChangesRequired = false;
+            }
+        }
+
+        // Autosave loaded iconset changes, saved on background thread
+        if (saveChangesRequired && !iconsAutosave.running && ((GetTime() - iconsAutosave.time) >= ICONS_AUTOSAVE_INTERVAL) &&
+            IsFileExtension(inFileName, ".rgi")) StartIconsAutosave(inFileName);
+#endif
+
         // Recover previous layout state from buffer
         if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z))
         {
@@ -736,10 +1108,14 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        PROFILE_END(PROFILE_UNDO);
         //----------------------------------------------------------------------------------
 
         // Dropped files logic
         //----------------------------------------------------------------------------------
+        PROFILE_BEGIN(PROFILE_INPUT);
+
         if (IsFileDropped())
         {
             FilePathList droppedFiles = LoadDroppedFiles();
@@ -754,15 +1130,24 @@ int main(int argc, char *argv[])
 
                 strcpy(inFileName, droppedFiles.paths[0]);
                 SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+            #if defined(SUPPORT_ICONS_AUTOSAVE)
+                iconsAutosave.time = GetTime();
+            #endif
+            #if defined(SUPPORT_ICONS_JOURNAL)
+                // Recover unsaved changes from icons journal (if available)
+                if (OpenIconsJournal(&iconsJournal, inFileName) > 0)
+                {
+                    SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
+                    saveChangesRequired = true;
+                }
+            #endif
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".png"))
             {
-                // TODO: Support icons loading from image
-                //Image image = LoadImage(droppedFiles[0]);
-                //LoadIconsFromImage(image, RAYGUI_ICON_MAX_ICONS, 16, 16, 1);    // Loading window required to config parameters (similar to raw)
-                //UnloadImage(image);
-
-                // TODO: Load icons name id from PNG zTXt chunk if available
+                // Load icons image, expected layout: 16 icons per line, 1 pixel padding
+                // NOTE: Icons name ids are also loaded from PNG zTXt chunk if available
+                // TODO: Loading window required to config parameters (similar to raw)
+                if (LoadIconsFromImage(droppedFiles.paths[0], 16, 1) > 0) saveChangesRequired = true;
             }
             else if (IsFileExtension(droppedFiles.paths[0], ".rgs")) GuiLoadStyle(droppedFiles.paths[0]);
 
@@ -793,9 +1178,16 @@ int main(int argc, char *argv[])
             }
             else if (saveChangesRequired)
             {
+    #if defined(SUPPORT_ICONS_AUTOSAVE)
+                JoinIconsAutosave();    // Wait for autosave in progress, same file written
+                iconsAutosave.time = GetTime();
+    #endif
                 SaveIcons(inFileName);
                 SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
                 saveChangesRequired = false;
+    #if defined(SUPPORT_ICONS_JOURNAL)
+                ResetIconsJournal(&iconsJournal, inFileName, currentIcons, guiIconsName);
+    #endif
             }
         }
 
@@ -837,7 +1229,8 @@ int main(int argc, char *argv[])
         }
 
         // Clean selected icon
-        if (IsKeyPressed(KEY_DELETE) || mainToolbarState.btnCleanPressed)
+        // NOTE: DEL key ignored while editing a text box
+        if ((IsKeyPressed(KEY_DELETE) && !iconNameIdEditMode && !iconsFilterEditMode) || mainToolbarState.btnCleanPressed)
         {
             for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++) ClearIconPixel(currentIcons, selectedIcon, i/RAYGUI_ICON_SIZE, i%RAYGUI_ICON_SIZE);
 
@@ -853,12 +1246,27 @@ int main(int argc, char *argv[])
         // Toggle window: report issue
         if (IsKeyPressed(KEY_F3)) showIssueReportWindow = !showIssueReportWindow;
 
+        // Toggle window: similar icons
+        // NOTE: Search is done on window opening, current icons do not change while window is shown
+        if (IsKeyPressed(KEY_F5))
+        {
+            showSimilarIconsWindow = !showSimilarIconsWindow;
+
+            if (showSimilarIconsWindow)
+            {
+                IconsTree tree = LoadIconsTree(currentIcons, RAYGUI_ICON_MAX_ICONS);
+                similarIconsCount = SearchIconsTree(tree, currentIcons + selectedIcon*RAYGUI_ICON_DATA_ELEMENTS, selectedIcon, similarIcons, SIMILAR_ICONS_COUNT);
+                UnloadIconsTree(tree);
+            }
+        }
+
         // Show closing window on ESC
         if (IsKeyPressed(KEY_ESCAPE))
         {
             if (windowHelpState.windowActive) windowHelpState.windowActive = false;
             else if (windowAboutState.windowActive) windowAboutState.windowActive = false;
             else if (showIssueReportWindow) showIssueReportWindow = false;
+            else if (showSimilarIconsWindow) showSimilarIconsWindow = false;
             else if (showExportWindow) showExportWindow = false;
         #if defined(PLATFORM_DESKTOP)
             else showExitWindow = !showExitWindow;
@@ -882,6 +1290,12 @@ int main(int argc, char *argv[])
         // Toggle full screen mode
         if (IsKeyDown(KEY_LEFT_ALT) && IsKeyPressed(KEY_ENTER)) ToggleFullscreen();
 #endif
+#if defined(SUPPORT_FRAME_PROFILER)
+        // Toggle frame profiler overlay
+        // NOTE: F12 is reserved by raylib for screenshots
+        if (IsKeyPressed(KEY_F10)) profiler.active = !profiler.active;
+#endif
+        PROFILE_END(PROFILE_INPUT);
         //----------------------------------------------------------------------------------
 
         // Main toolbar logic
@@ -890,29 +1304,21 @@ int main(int argc, char *argv[])
         //if ((styleFrameCounter%120) == 0) mainToolbarState.visualStyleActive++;
         //if (mainToolbarState.visualStyleActive > 11) mainToolbarState.visualStyleActive = 0;
 
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+        // Cache visual styles progressively, one style per frame
+        // NOTE: Font atlas already decompressed on background, only texture upload required
+        if (stylePreloadIndex < MAX_GUI_STYLES_AVAILABLE)
+        {
+            CacheVisualStyle(stylePreloadIndex);
+            stylePreloadIndex++;
+        }
+#endif
         // Visual options logic
         if (mainToolbarState.visualStyleActive != mainToolbarState.prevVisualStyleActive)
         {
             // When a new template style is selected, everything is reseted
-            GuiLoadStyleDefault();
-
-            switch (mainToolbarState.visualStyleActive)
-            {
-                case 1: GuiLoadStyleJungle(); break;
-                case 2: GuiLoadStyleCandy(); break;
-                case 3: GuiLoadStyleLavanda(); break;
-                case 4: GuiLoadStyleCyber(); break;
-                case 5: GuiLoadStyleTerminal(); break;
-                case 6: GuiLoadStyleAshes(); break;
-                case 7: GuiLoadStyleBluish(); break;
-                case 8: GuiLoadStyleDark(); break;
-                case 9: GuiLoadStyleCherry(); break;
-                case 10: GuiLoadStyleSunny(); break;
-                case 11: GuiLoadStyleEnefete(); break;
-                case 12: GuiLoadStyleAmber(); break;
-                case 13: GuiLoadStyleGenesis(); break;
-                default: break;
-            }
+            // NOTE: Styles are decoded only first time selected, next times are restored from cache
+            LoadVisualStyle(mainToolbarState.visualStyleActive);
 
             saveChangesRequired = false;
 
@@ -929,6 +1335,7 @@ int main(int argc, char *argv[])
         if (windowHelpState.windowActive ||
             windowAboutState.windowActive ||
             showIssueReportWindow ||
+            showSimilarIconsWindow ||
             showExitWindow ||
             showExportWindow ||
             showLoadFileDialog ||
@@ -944,10 +1351,15 @@ int main(int argc, char *argv[])
             if (iconEditScale < 2) iconEditScale = 2;
             else if (iconEditScale > 16) iconEditScale = 16;
 
-            mouseHoverCells = CheckCollisionPointRec(GetMousePosition(), (Rectangle){ anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, RAYGUI_ICON_SIZE*iconEditScale, RAYGUI_ICON_SIZE*iconEditScale });
+            Rectangle gridBounds = { anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, RAYGUI_ICON_SIZE*iconEditScale, RAYGUI_ICON_SIZE*iconEditScale };
+            mouseHoverCells = CheckCollisionPointRec(GetMousePosition(), gridBounds);
 
             if (mouseHoverCells)
             {
+                // Cell computed from current mouse position, grid cell is only updated when grid is drawn
+                cell.x = (float)(int)((GetMousePosition().x - gridBounds.x)/iconEditScale);
+                cell.y = (float)(int)((GetMousePosition().y - gridBounds.y)/iconEditScale);
+
                 // Security check to avoid cells out of limits
                 if (cell.x > (RAYGUI_ICON_SIZE - 1)) cell.x = RAYGUI_ICON_SIZE - 1;
                 if (cell.y > (RAYGUI_ICON_SIZE - 1)) cell.y = RAYGUI_ICON_SIZE - 1;
@@ -955,11 +1367,62 @@ int main(int argc, char *argv[])
                 // Icon painting mouse logic
                 if ((cell.x >= 0) && (cell.y >= 0) && (cell.x < RAYGUI_ICON_SIZE) && (cell.y < RAYGUI_ICON_SIZE))
                 {
-                    if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) SetIconPixel(currentIcons, selectedIcon, (int)cell.x, (int)cell.y);
-                    else if (IsMouseButtonDown(MOUSE_RIGHT_BUTTON)) ClearIconPixel(currentIcons, selectedIcon, (int)cell.x, (int)cell.y);
+                    if (editToolActive == EDIT_TOOL_PENCIL)
+                    {
+                        // Pencil stroke: line from previous frame cell to current one, no gaps on fast mouse moves,
+                        // independently of frame rate, all stroke pixels applied at once
+                        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) || IsMouseButtonDown(MOUSE_RIGHT_BUTTON))
+                        {
+                            if (strokeLastCell.x < 0) strokeLastCell = cell;
+
+                            GenIconShapeMask(shapeMask, EDIT_TOOL_LINE, (int)strokeLastCell.x, (int)strokeLastCell.y, (int)cell.x, (int)cell.y);
+                            ApplyIconMask(currentIcons + selectedIcon*RAYGUI_ICON_DATA_ELEMENTS, shapeMask, IsMouseButtonDown(MOUSE_LEFT_BUTTON));
+
+                            strokeLastCell = cell;
+                        }
+                        else strokeLastCell = (Vector2){ -1, -1 };
+                    }
+                    else if (!shapeEditing && (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)))
+                    {
+                        shapeEditing = true;
+                        shapeSetPixels = IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+                        shapeStartCell = cell;
+
+                        // NOTE: Pending changes recorded as undo step before shape is applied
+                        undoFrameCounter = 120;
+                    }
+
+                    if (shapeEditing) shapeEndCell = cell;
+                }
+            }
+
+            // Shape/fill tools logic: previewed while mouse button down, applied on release
+            // NOTE: Applied all at once, undo step recorded on next frame (one undo step per shape)
+            if (shapeEditing)
+            {
+                unsigned int *iconData = currentIcons + selectedIcon*RAYGUI_ICON_DATA_ELEMENTS;
+
+                if (editToolActive == EDIT_TOOL_FILL) GenIconFillMask(shapeMask, iconData, (int)shapeStartCell.x, (int)shapeStartCell.y);
+                else GenIconShapeMask(shapeMask, editToolActive, (int)shapeStartCell.x, (int)shapeStartCell.y, (int)shapeEndCell.x, (int)shapeEndCell.y);
+
+                memcpy(shapePreview, iconData, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                ApplyIconMask(shapePreview, shapeMask, shapeSetPixels);
+
+                // NOTE: Not applied on pressed frame, pending changes must be recorded first
+                int shapeButton = shapeSetPixels? MOUSE_LEFT_BUTTON : MOUSE_RIGHT_BUTTON;
+
+                if (!IsMouseButtonDown(shapeButton) && !IsMouseButtonPressed(shapeButton))
+                {
+                    memcpy(iconData, shapePreview, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                    shapeEditing = false;
+                    undoFrameCounter = 120;
                 }
             }
         }
+        else shapeEditing = false;      // Shape canceled if any window is shown
+
+        // Pencil stroke ends when mouse leaves grid or tool changes
+        if (!mouseHoverCells || GuiIsLocked() || (editToolActive != EDIT_TOOL_PENCIL)) strokeLastCell = (Vector2){ -1, -1 };
         //----------------------------------------------------------------------------------
 
         // Screen scale logic (x2)
@@ -984,318 +1447,475 @@ int main(int argc, char *argv[])
         }
         //----------------------------------------------------------------------------------
 
-        // Draw
+        // Icons content index update (only changed icons hashed again)
         //----------------------------------------------------------------------------------
-        // Render all screen to texture (for scaling)
-        BeginTextureMode(target);
-            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
-
-            // GUI: Main screen controls
-            //---------------------------------------------------------------------------------------------------------
-            GuiLabel((Rectangle){ anchor01.x + 15, anchor01.y + 45, 140, 25 }, "Choose icon for edit:");
-
-            // Draw icons selection panel
-            // NOTE: We point raygui icons pointer to current iconset to be used on drawing (instead of the internal one)
-            //GuiSetStyle(TOGGLE, GROUP_PADDING, -1);
-            guiIconsPtr = currentIcons;
-            GuiToggleGroup((Rectangle){ anchor01.x + 15, anchor01.y + 70, 18, 18 }, toggleIconsText, &selectedIcon);
-            guiIconsPtr = backupGuiIcons;
-
-            // Draw icon name ID text box
-            GuiLabel((Rectangle){ anchor01.x + 365, anchor01.y + 45, 126, 25 }, "Icon name ID:");
-            if (GuiTextBox((Rectangle){ anchor01.x + 365, anchor01.y + 70, 258, 25 }, guiIconsName[selectedIcon], 32, iconNameIdEditMode)) iconNameIdEditMode = !iconNameIdEditMode;
+        UpdateIconsIndex(&iconsIndex, currentIcons);
 
-            // Draw selected icon at selected scale
-            DrawRectangle(anchor01.x + 365, anchor01.y + 108, 256, 256, Fade(GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_NORMAL)), 0.3f));
-            DrawIcon(currentIcons, selectedIcon, (int)anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, (int)anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, iconEditScale, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
+        // Icons filtering by name id, only updated on filter text or name ids changes
+        // NOTE: Selected icon moved to exact name id match or first filtered icon, only on filter text changes
+        bool iconsFilterChanged = (strcmp(iconsFilterText, prevIconsFilterText) != 0);
 
-            // Draw grid (returns selected cell)
-            GuiGrid((Rectangle){ anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, RAYGUI_ICON_SIZE*iconEditScale, RAYGUI_ICON_SIZE*iconEditScale }, NULL, iconEditScale, 1, &cell);
-
-            if (mouseHoverCells)
-            {
-                // Draw selected cell lines
-                if ((cell.x >= 0) && (cell.y >= 0) && (cell.x < RAYGUI_ICON_SIZE) && (cell.y < RAYGUI_ICON_SIZE))
-                {
-                    DrawRectangleLinesEx((Rectangle){ anchor01.x + 365 + iconEditScale*cell.x + 128 - RAYGUI_ICON_SIZE*iconEditScale/2,
-                                                      anchor01.y + 108 + iconEditScale*cell.y + 128 - RAYGUI_ICON_SIZE*iconEditScale/2,
-                                                      iconEditScale + 1, iconEditScale + 1 }, 1, RED);
-                }
-            }
+        if ((UpdateIconsNameIndex(&iconsNameIndex, guiIconsName, RAYGUI_ICON_MAX_ICONS) > 0) || iconsFilterChanged)
+        {
+            iconsFilterCount = FilterIconsByName(&iconsNameIndex, iconsFilterText, iconsFilterMatches);
+            strcpy(prevIconsFilterText, iconsFilterText);
 
-            float iconEditScaleF = (float)iconEditScale;
-            GuiSliderBar((Rectangle){ anchor01.x + 410, anchor01.y + 376, 180, 10 }, "ZOOM:", TextFormat("x%i", iconEditScale), &iconEditScaleF, 0.0f, 16.0f);
-            iconEditScale = (int)iconEditScaleF;
-            if (iconEditScale < 2) iconEditScale = 2;
-            else if (iconEditScale > 16) iconEditScale = 16;
-            //--------------------------------------------------------------------------------
-
-            // GUI: Main toolbar panel
-            //----------------------------------------------------------------------------------
-            GuiMainToolbar(&mainToolbarState);
-            if (iconDataToCopy) DrawIconData(iconData, mainToolbarState.anchorEdit.x + 12 + 72 + 16 + 4, mainToolbarState.anchorEdit.y + 8 + 4, 1, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL)));
-            //----------------------------------------------------------------------------------
-
-            // GUI: Status bar
-            //--------------------------------------------------------------------------------
-            int textPadding = GuiGetStyle(STATUSBAR, TEXT_PADDING);
-            GuiSetStyle(STATUSBAR, TEXT_PADDING, 15);
-            GuiStatusBar((Rectangle){ 0, screenHeight - 24, 351, 24 }, TextFormat("TOTAL ICONS: %i", RAYGUI_ICON_MAX_ICONS));
-            GuiStatusBar((Rectangle){ 350, screenHeight - 24, screenWidth - 350, 24 }, TextFormat("SELECTED: %i - %s", selectedIcon, guiIconsName[selectedIcon]));
-            GuiSetStyle(STATUSBAR, TEXT_PADDING, textPadding);
-            //--------------------------------------------------------------------------------
-
-            // NOTE: If some overlap window is open and main window is locked, we draw a background rectangle
-            if (GuiIsLocked()) DrawRectangle(0, 0, screenWidth, screenHeight, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
-
-            // WARNING: Before drawing the windows, we unlock them
-            GuiUnlock();
-
-            // GUI: Help Window
-            //----------------------------------------------------------------------------------------
-            windowHelpState.windowBounds.x = (float)screenWidth/2 - windowHelpState.windowBounds.width/2;
-            windowHelpState.windowBounds.y = (float)screenHeight/2 - windowHelpState.windowBounds.height/2;
-            GuiWindowHelp(&windowHelpState);
-            //----------------------------------------------------------------------------------------
-
-            // GUI: About Window
-            //----------------------------------------------------------------------------------------
-            windowAboutState.windowBounds.x = (float)screenWidth/2 - windowAboutState.windowBounds.width/2;
-            windowAboutState.windowBounds.y = (float)screenHeight/2 - windowAboutState.windowBounds.height/2;
-            GuiWindowAbout(&windowAboutState);
-            //----------------------------------------------------------------------------------------
-
-            // GUI: Issue Report Window
-            //----------------------------------------------------------------------------------------
-            if (showIssueReportWindow)
+            if (iconsFilterChanged)
             {
-                Rectangle messageBox = { (float)screenWidth/2 - 300/2, (float)screenHeight/2 - 190/2 - 20, 300, 190 };
-                int result = GuiMessageBox(messageBox, "#220#Report Issue",
-                    "Do you want to report any issue or\nfeature request for this program?\n\ngithub.com/raysan5/rguiicons", "#186#Report on GitHub");
+                int iconId = FindIconByName(&iconsNameIndex, iconsFilterText);
 
-                if (result == 1)    // Report issue pressed
+                if (iconId >= 0) selectedIcon = iconId;
+                else if ((iconsFilterCount > 0) && !iconsFilterMatches[selectedIcon])
                 {
-                    OpenURL("https://github.com/raysan5/rguiicons/issues");
-                    showIssueReportWindow = false;
+                    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) if (iconsFilterMatches[i]) { selectedIcon = i; break; }
                 }
-                else if (result == 0) showIssueReportWindow = false;
             }
-            //----------------------------------------------------------------------------------------
-
-            // GUI: Export Window
-            //----------------------------------------------------------------------------------------
-            if (showExportWindow)
-            {
-                Rectangle messageBox = { (float)screenWidth/2 - 280/2, (float)screenHeight/2 - 176/2 - 30, 280, 176 };
-                int result = GuiMessageBox(messageBox, "#7#Export Iconset File", " ", "#7#Export Iconset");
+        }
+        //----------------------------------------------------------------------------------
 
-                GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12, 106, 24 }, "Iconset Name:");
-                if (GuiTextBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 24 + 12, 164, 24 }, styleNameText, 128, styleNameEditMode)) styleNameEditMode = !styleNameEditMode;
+        // Screen redraw logic
+        //----------------------------------------------------------------------------------
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+        // Check for changes requiring screen redraw: input events, icons changed (undo, load, paste...),
+        // visual style changed or window state changed
+        if (inputDetected ||
+            (memcmp(drawnIcons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0) ||
+            (mainToolbarState.visualStyleActive != drawnVisualStyle) ||
+            (IsWindowFocused() != windowFocused) ||
+            IsWindowResized())
+        {
+            memcpy(drawnIcons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            drawnVisualStyle = mainToolbarState.visualStyleActive;
+            windowFocused = IsWindowFocused();
 
-                GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 12 + 48 + 8, 106, 24 }, "File Format:");
-                GuiComboBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 12 + 48 + 8, 164, 24 }, "raygui (.rgi);Image (.png);Code (.h)", &exportFormatActive);
+            redrawFramesCounter = REDRAW_FRAMES_ON_CHANGE;
+        }
+        // File dialogs are polled on drawing, native ones are shown on a worker thread
+        if (showLoadFileDialog || showSaveFileDialog || showExportFileDialog) redrawFramesCounter = REDRAW_FRAMES_ON_CHANGE;
+    #if defined(SUPPORT_FRAME_PROFILER)
+        // Screen redrawn every frame while profiling, timings shown must be live
+        if (profiler.active) redrawFramesCounter = REDRAW_FRAMES_ON_CHANGE;
+    #endif
+#else
+        redrawFramesCounter = 1;    // Screen redrawn every frame
+#endif
+        //----------------------------------------------------------------------------------
 
-                if (exportFormatActive != 1) GuiDisable();
-                GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 52 + 32 + 24, 16, 16 }, "Embed name IDs as zTXt chunk", &nameIdsChunkChecked);
-                GuiEnable();
+        // Draw
+        //----------------------------------------------------------------------------------
+        bool frameDrawn = (redrawFramesCounter > 0);
 
-                if (result == 1)    // Export button pressed
+        if (frameDrawn)
+        {
+            // Render all screen to texture (for scaling)
+            BeginTextureMode(target);
+                ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+                // GUI: Main screen controls
+                //---------------------------------------------------------------------------------------------------------
+                GuiLabel((Rectangle){ anchor01.x + 15, anchor01.y + 45, 140, 25 }, "Choose icon for edit:");
+
+                // Draw icons selection panel
+                // NOTE: We point raygui icons pointer to current iconset to be used on drawing (instead of the internal one)
+                //GuiSetStyle(TOGGLE, GROUP_PADDING, -1);
+                PROFILE_BEGIN(PROFILE_TOGGLEGROUP);
+                guiIconsPtr = currentIcons;
+                GuiToggleGroup((Rectangle){ anchor01.x + 15, anchor01.y + 70, 18, 18 }, toggleIconsText, &selectedIcon);
+                guiIconsPtr = backupGuiIcons;
+
+                // Draw icons filter by name id, icons not matching filter are faded
+                if (GuiTextBox((Rectangle){ anchor01.x + 175, anchor01.y + 47, 158, 20 }, iconsFilterText, RAYGUI_ICON_MAX_NAME_LENGTH, iconsFilterEditMode)) iconsFilterEditMode = !iconsFilterEditMode;
+                if ((iconsFilterText[0] == '\0') && !iconsFilterEditMode) GuiLabel((Rectangle){ anchor01.x + 180, anchor01.y + 47, 150, 20 }, "#42#Filter by name id");
+
+                if (iconsFilterText[0] != '\0')
                 {
-                    showExportWindow = false;
-                    showExportFileDialog = true;
+                    int groupPadding = GuiGetStyle(TOGGLE, GROUP_PADDING);
+
+                    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+                    {
+                        if (!iconsFilterMatches[i]) DrawRectangle((int)anchor01.x + 15 + (i%16)*(18 + groupPadding), (int)anchor01.y + 70 + (i/16)*(18 + groupPadding), 18, 18, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.8f));
+                    }
                 }
-                else if (result == 0) showExportWindow = false;
-            }
-            //----------------------------------------------------------------------------------
+                PROFILE_END(PROFILE_TOGGLEGROUP);
 
-            // GUI: Exit Window
-            //----------------------------------------------------------------------------------------
-            if (showExitWindow)
-            {
-                int result = GuiMessageBox((Rectangle){ screenWidth/2 - 125, screenHeight/2 - 50, 250, 100 }, TextFormat("#159#Closing %s", toolName), "Do you really want to exit?", "Yes;No");
+                // Draw icon name ID text box
+                GuiLabel((Rectangle){ anchor01.x + 365, anchor01.y + 45, 126, 25 }, "Icon name ID:");
+                if (GuiTextBox((Rectangle){ anchor01.x + 365, anchor01.y + 70, 258, 25 }, guiIconsName[selectedIcon], 32, iconNameIdEditMode)) iconNameIdEditMode = !iconNameIdEditMode;
 
-                if ((result == 0) || (result == 2)) showExitWindow = false;
-                else if (result == 1) closeWindow = true;
-            }
-            //----------------------------------------------------------------------------------------
+                // Draw selected icon at selected scale
+                PROFILE_BEGIN(PROFILE_DRAWICON);
+                DrawRectangle(anchor01.x + 365, anchor01.y + 108, 256, 256, Fade(GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_NORMAL)), 0.3f));
+                if (shapeEditing) DrawIconData(shapePreview, (int)anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, (int)anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, iconEditScale, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
+                else DrawIcon(currentIcons, selectedIcon, (int)anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, (int)anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, iconEditScale, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
+                PROFILE_END(PROFILE_DRAWICON);
 
-            // GUI: Load File Dialog (and loading logic)
-            //----------------------------------------------------------------------------------------
-            if (showLoadFileDialog)
-            {
-#if defined(CUSTOM_MODAL_DIALOGS)
-                int result = GuiFileDialog(DIALOG_MESSAGE, "Load raygui icons file", inFileName, "Ok", "Just drag and drop your .rgi style file!");
-#else
-                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load raygui icons file", inFileName, "*.rgi", "raygui Icons Files (*.rgi)");
-#endif
-                if (result == 1)
+                // Draw grid (returns selected cell)
+                PROFILE_BEGIN(PROFILE_GRID);
+                GuiGrid((Rectangle){ anchor01.x + 365 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, anchor01.y + 108 + 128 - RAYGUI_ICON_SIZE*iconEditScale/2, RAYGUI_ICON_SIZE*iconEditScale, RAYGUI_ICON_SIZE*iconEditScale }, NULL, iconEditScale, 1, &cell);
+
+                if (mouseHoverCells)
                 {
-                    // Load gui icons data (and gui icon names for the tool)
-                    char **tempIconsName = GuiLoadIcons(inFileName, true);
-                    memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-                    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); free(tempIconsName[i]); }
-                    free(tempIconsName);
-
-                    SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
-                    saveChangesRequired = false;
+                    // Draw selected cell lines
+                    if ((cell.x >= 0) && (cell.y >= 0) && (cell.x < RAYGUI_ICON_SIZE) && (cell.y < RAYGUI_ICON_SIZE))
+                    {
+                        DrawRectangleLinesEx((Rectangle){ anchor01.x + 365 + iconEditScale*cell.x + 128 - RAYGUI_ICON_SIZE*iconEditScale/2,
+                                                          anchor01.y + 108 + iconEditScale*cell.y + 128 - RAYGUI_ICON_SIZE*iconEditScale/2,
+                                                          iconEditScale + 1, iconEditScale + 1 }, 1, RED);
+                    }
                 }
+                PROFILE_END(PROFILE_GRID);
+
+                // Draw edition tools: pencil, line, rectangle, ellipse, fill
+                GuiToggleGroup((Rectangle){ anchor01.x + 365, anchor01.y + 370, 24, 20 }, "#22#;#192#;#63#;#213#;#29#", &editToolActive);
+
+                float iconEditScaleF = (float)iconEditScale;
+                GuiSliderBar((Rectangle){ anchor01.x + 540, anchor01.y + 376, 60, 10 }, "ZOOM:", TextFormat("x%i", iconEditScale), &iconEditScaleF, 0.0f, 16.0f);
+                iconEditScale = (int)iconEditScaleF;
+                if (iconEditScale < 2) iconEditScale = 2;
+                else if (iconEditScale > 16) iconEditScale = 16;
+                //--------------------------------------------------------------------------------
+
+                // GUI: Main toolbar panel
+                //----------------------------------------------------------------------------------
+                PROFILE_BEGIN(PROFILE_TOOLBAR);
+                GuiMainToolbar(&mainToolbarState);
+                if (iconDataToCopy) DrawIconData(iconData, mainToolbarState.anchorEdit.x + 12 + 72 + 16 + 4, mainToolbarState.anchorEdit.y + 8 + 4, 1, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL)));
+                PROFILE_END(PROFILE_TOOLBAR);
+                //----------------------------------------------------------------------------------
+
+                // GUI: Status bar
+                //--------------------------------------------------------------------------------
+                int textPadding = GuiGetStyle(STATUSBAR, TEXT_PADDING);
+                GuiSetStyle(STATUSBAR, TEXT_PADDING, 15);
+                if (iconsFilterText[0] != '\0') GuiStatusBar((Rectangle){ 0, screenHeight - 24, 351, 24 }, TextFormat("FILTERED ICONS: %i - DUPLICATES: %i", iconsFilterCount, iconsIndex.duplicateCount));
+                else GuiStatusBar((Rectangle){ 0, screenHeight - 24, 351, 24 }, TextFormat("TOTAL ICONS: %i - DUPLICATES: %i", RAYGUI_ICON_MAX_ICONS, iconsIndex.duplicateCount));
+                if (iconsIndex.duplicateOf[selectedIcon] >= 0) GuiStatusBar((Rectangle){ 350, screenHeight - 24, screenWidth - 350, 24 }, TextFormat("SELECTED: %i - %s (DUPLICATE OF %i)", selectedIcon, guiIconsName[selectedIcon], iconsIndex.duplicateOf[selectedIcon]));
+                else GuiStatusBar((Rectangle){ 350, screenHeight - 24, screenWidth - 350, 24 }, TextFormat("SELECTED: %i - %s", selectedIcon, guiIconsName[selectedIcon]));
+                GuiSetStyle(STATUSBAR, TEXT_PADDING, textPadding);
+                //--------------------------------------------------------------------------------
+
+                // NOTE: If some overlap window is open and main window is locked, we draw a background rectangle
+                if (GuiIsLocked()) DrawRectangle(0, 0, screenWidth, screenHeight, Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
+
+                // WARNING: Before drawing the windows, we unlock them
+                GuiUnlock();
+
+                PROFILE_BEGIN(PROFILE_WINDOWS);
+
+                // GUI: Help Window
+                //----------------------------------------------------------------------------------------
+                windowHelpState.windowBounds.x = (float)screenWidth/2 - windowHelpState.windowBounds.width/2;
+                windowHelpState.windowBounds.y = (float)screenHeight/2 - windowHelpState.windowBounds.height/2;
+                GuiWindowHelp(&windowHelpState);
+                //----------------------------------------------------------------------------------------
+
+                // GUI: About Window
+                //----------------------------------------------------------------------------------------
+                windowAboutState.windowBounds.x = (float)screenWidth/2 - windowAboutState.windowBounds.width/2;
+                windowAboutState.windowBounds.y = (float)screenHeight/2 - windowAboutState.windowBounds.height/2;
+                GuiWindowAbout(&windowAboutState);
+                //----------------------------------------------------------------------------------------
+
+                // GUI: Issue Report Window
+                //----------------------------------------------------------------------------------------
+                if (showIssueReportWindow)
+                {
+                    Rectangle messageBox = { (float)screenWidth/2 - 300/2, (float)screenHeight/2 - 190/2 - 20, 300, 190 };
+                    int result = GuiMessageBox(messageBox, "#220#Report Issue",
+                        "Do you want to report any issue or\nfeature request for this program?\n\ngithub.com/raysan5/rguiicons", "#186#Report on GitHub");
 
-                if (result >= 0) showLoadFileDialog = false;
-            }
-            //----------------------------------------------------------------------------------------
+                    if (result == 1)    // Report issue pressed
+                    {
+                        OpenURL("https://github.com/raysan5/rguiicons/issues");
+                        showIssueReportWindow = false;
+                    }
+                    else if (result == 0) showIssueReportWindow = false;
+                }
+                //----------------------------------------------------------------------------------------
 
-            // GUI: Save File Dialog (and saving logic)
-            //----------------------------------------------------------------------------------------
-            if (showSaveFileDialog)
-            {
-#if defined(CUSTOM_MODAL_DIALOGS)
-                //int result = GuiFileDialog(DIALOG_TEXTINPUT, "Save raygui icons file...", outFileName, "Ok;Cancel", NULL);
-                int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 30, 280, 112 }, "#2#Save raygui icon file...", NULL, "#2#Save", outFileName, 512, NULL);
-#else
-                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Save raygui icons file...", outFileName, "*.rgi", "raygui Icons Files (*.rgi)");
-#endif
-                if (result == 1)
+                // GUI: Similar Icons Window
+                //----------------------------------------------------------------------------------------
+                if (showSimilarIconsWindow)
                 {
-                    // Save icons file
-                    // Check for valid extension and make sure it is
-                    if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
-
-                    // Save icons file
-                    SaveIcons(outFileName);
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (we can't use directories)
-                    // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
-                    if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
-                }
+                    Rectangle windowBox = { (float)screenWidth/2 - 344/2, (float)screenHeight/2 - 214/2 - 20, 344, 214 };
+                    showSimilarIconsWindow = !GuiWindowBox(windowBox, TextFormat("#181#Icons Similar To #%i", selectedIcon));
 
-                if (result >= 0) showSaveFileDialog = false;
-            }
-            //----------------------------------------------------------------------------------------
+                    if (similarIconsCount == 0) GuiLabel((Rectangle){ windowBox.x + 12, windowBox.y + 24 + 12, windowBox.width - 24, 24 }, "No similar icons found: empty iconset");
 
-            // GUI: Export File Dialog (and saving logic)
-            //----------------------------------------------------------------------------------------
-            if (showExportFileDialog)
-            {
-#if defined(CUSTOM_MODAL_DIALOGS)
-                //int result = GuiFileDialog(DIALOG_TEXTINPUT, "Export raygui icons file...", outFileName, "Ok;Cancel", NULL);
-                int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 60, 280, 112 }, "#7#Export raygui icon file...", NULL, "#7#Export", outFileName, 512, NULL);
-#else
-                char filters[64] = { 0 };   // Consider different supported file types
+                    // Similar icons grid (4x2), sorted by distance, clicking on icon selects it
+                    for (int i = 0; i < similarIconsCount; i++)
+                    {
+                        Rectangle iconButton = { windowBox.x + 12 + (i%4)*82, windowBox.y + 24 + 12 + (i/4)*88, 74, 80 };
 
-                switch (exportFormatActive)
-                {
-                    case 0: strcpy(filters, "*.rgi"); strcat(outFileName, ".rgi"); break;   // Icons file (.rgi)
-                    case 1: strcpy(filters, "*.png"); strcat(outFileName, ".png"); break;   // Icons image (.png)
-                    case 2: strcpy(filters, "*.h"); strcat(outFileName, ".h"); break;       // Icons code (.h)
-                    default: break;
+                        if (GuiButton(iconButton, NULL))
+                        {
+                            selectedIcon = similarIcons[i].entry;
+                            showSimilarIconsWindow = false;
+                        }
+
+                        DrawIcon(currentIcons, similarIcons[i].entry, (int)iconButton.x + 21, (int)iconButton.y + 10, 2, GetColor(GuiGetStyle(LABEL, TEXT_COLOR_NORMAL)));
+                        GuiLabel((Rectangle){ iconButton.x + 6, iconButton.y + 50, iconButton.width - 12, 24 }, TextFormat("#%i d:%i", similarIcons[i].entry, similarIcons[i].distance));
+                    }
                 }
+                //----------------------------------------------------------------------------------------
 
-                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Export raygui icons file...", outFileName, filters, TextFormat("File type (%s)", filters));
-#endif
-                if (result == 1)
+                // GUI: Export Window
+                //----------------------------------------------------------------------------------------
+                if (showExportWindow)
                 {
-                    // Export file: outFileName
-                    switch (exportFormatActive)
+                    Rectangle messageBox = { (float)screenWidth/2 - 280/2, (float)screenHeight/2 - 176/2 - 30, 280, 176 };
+                    int result = GuiMessageBox(messageBox, "#7#Export Iconset File", " ", "#7#Export Iconset");
+
+                    GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12, 106, 24 }, "Iconset Name:");
+                    if (GuiTextBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 24 + 12, 164, 24 }, styleNameText, 128, styleNameEditMode)) styleNameEditMode = !styleNameEditMode;
+
+                    GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 12 + 48 + 8, 106, 24 }, "File Format:");
+                    GuiComboBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 12 + 48 + 8, 164, 24 }, "raygui (.rgi);Image (.png);Code (.h)", &exportFormatActive);
+
+                    if (exportFormatActive != 1) GuiDisable();
+                    GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 52 + 32 + 24, 16, 16 }, "Embed name IDs as zTXt chunk", &nameIdsChunkChecked);
+                    GuiEnable();
+
+                    if (result == 1)    // Export button pressed
                     {
-                        case 0:
-                        {
-                            // Check for valid extension and make sure it is
-                            if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
-                            SaveIcons(outFileName);
-                        } break;
-                        case 1:
-                        {
-                            // Check for valid extension and make sure it is
-                            if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
-                            Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
-                            ExportImage(image, outFileName);
-                            UnloadImage(image);
+                        showExportWindow = false;
+                        showExportFileDialog = true;
 
-                            if (nameIdsChunkChecked)
-                            {
-                                // Concatenate all icons names into one string
-                                char *iconsNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*32, 1);
-                                char *iconsNamesPtr = iconsNames;
-                                for (int i = 0, size = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
-                                {
-                                    size = strlen(guiIconsName[i]);
-                                    memcpy(iconsNamesPtr, guiIconsName[i], size);
-                                    iconsNamesPtr[size] = ';';
-                                    iconsNamesPtr += (size + 1);
-                                }
-
-                                // Save icons name id into PNG zTXt chunk
-                                rpng_chunk_write_comp_text(outFileName, "Description", iconsNames);
-                                RL_FREE(iconsNames);
-                            }
-                        } break;
-                        case 2:
+                    #if !defined(CUSTOM_MODAL_DIALOGS)
+                        switch (exportFormatActive)
                         {
-                            // Check for valid extension and make sure it is
-                            if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".h")) strcat(outFileName, ".h\0");
-                            ExportIconsAsCode(outFileName);
-                        } break;
-                        default: break;
+                            case 0: strcat(outFileName, ".rgi"); break;     // Icons file (.rgi)
+                            case 1: strcat(outFileName, ".png"); break;     // Icons image (.png)
+                            case 2: strcat(outFileName, ".h"); break;       // Icons code (.h)
+                            default: break;
+                        }
+                    #endif
                     }
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (we can't use directories)
-                    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
+                    else if (result == 0) showExportWindow = false;
                 }
+                //----------------------------------------------------------------------------------
 
-                if (result >= 0) showExportFileDialog = false;
-            }
-            //----------------------------------------------------------------------------------------
+                // GUI: Exit Window
+                //----------------------------------------------------------------------------------------
+                if (showExitWindow)
+                {
+                    int result = GuiMessageBox((Rectangle){ screenWidth/2 - 125, screenHeight/2 - 50, 250, 100 }, TextFormat("#159#Closing %s", toolName), "Do you really want to exit?", "Yes;No");
 
-            // GUI: Export Icon Image Dialog (and saving logic)
-            //----------------------------------------------------------------------------------------
-            /*
-            if (showExportIconImageDialog)
-            {
-                //strcpy(outFileName, TextFormat("%s_%ix%i.png", TextToLower(guiIconsName[selectedIcon]), RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE));
+                    if ((result == 0) || (result == 2)) showExitWindow = false;
+                    else if (result == 1) closeWindow = true;
+                }
+                //----------------------------------------------------------------------------------------
 
-#if defined(CUSTOM_MODAL_DIALOGS)
-                int result = GuiFileDialog(DIALOG_TEXTINPUT, "Export raygui icon as image file...", outFileName, "Ok;Cancel", NULL);
-#else
-                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Export raygui icon as image file...", outFileName, "*.png", "Image File (*.png)");
-#endif
-                if (result == 1)
+                // GUI: Load File Dialog (and loading logic)
+                //----------------------------------------------------------------------------------------
+                if (showLoadFileDialog)
                 {
-                    // Export file: outFileName
-                    // Check for valid extension and make sure it is
-                    if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
-                    Image icon = GenImageFromIconData(GuiGetIconData(selectedIcon), 1, 1, 0);
-                    ExportImage(icon, outFileName);
-                    UnloadImage(icon);
-
-                    // Save icon name id into PNG tEXt chunk
-                    rpng_chunk_write_text(outFileName, "Description", guiIconsName[selectedIcon]);
-
-                #if defined(PLATFORM_WEB)
-                    // Download file from MEMFS (emscripten memory filesystem)
-                    // NOTE: Second argument must be a simple filename (we can't use directories)
-                    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
-                #endif
+    #if defined(CUSTOM_MODAL_DIALOGS)
+                    int result = GuiFileDialog(DIALOG_MESSAGE, "Load raygui icons file", inFileName, "Ok", "Just drag and drop your .rgi style file!");
+    #else
+                    int result = GuiFileDialogAsync(DIALOG_OPEN_FILE, "Load raygui icons file", inFileName, "*.rgi", "raygui Icons Files (*.rgi)");
+    #endif
+                    if (result == 1)
+                    {
+                        // Load gui icons data (and gui icon names for the tool)
+                        char **tempIconsName = GuiLoadIcons(inFileName, true);
+                        memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); free(tempIconsName[i]); }
+                        free(tempIconsName);
+
+                        SetWindowTitle(TextFormat("%s v%s | File: %s", toolName, toolVersion, GetFileName(inFileName)));
+                        saveChangesRequired = false;
+                    #if defined(SUPPORT_ICONS_AUTOSAVE)
+                        iconsAutosave.time = GetTime();
+                    #endif
+                    #if defined(SUPPORT_ICONS_JOURNAL)
+                        // Recover unsaved changes from icons journal (if available)
+                        if (OpenIconsJournal(&iconsJournal, inFileName) > 0)
+                        {
+                            SetWindowTitle(TextFormat("%s v%s | File: %s*", toolName, toolVersion, GetFileName(inFileName)));
+                            saveChangesRequired = true;
+                        }
+                    #endif
+                    }
+
+                    if (result >= 0) showLoadFileDialog = false;
                 }
+                //----------------------------------------------------------------------------------------
 
-                if (result >= 0) showExportIconImageDialog = false;
-            }
-            */
-            //----------------------------------------------------------------------------------------
+                // GUI: Save File Dialog (and saving logic)
+                //----------------------------------------------------------------------------------------
+                if (showSaveFileDialog)
+                {
+    #if defined(CUSTOM_MODAL_DIALOGS)
+                    //int result = GuiFileDialog(DIALOG_TEXTINPUT, "Save raygui icons file...", outFileName, "Ok;Cancel", NULL);
+                    int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 30, 280, 112 }, "#2#Save raygui icon file...", NULL, "#2#Save", outFileName, 512, NULL);
+    #else
+                    int result = GuiFileDialogAsync(DIALOG_SAVE_FILE, "Save raygui icons file...", outFileName, "*.rgi", "raygui Icons Files (*.rgi)");
+    #endif
+                    if (result == 1)
+                    {
+                        // Save icons file
+                        // Check for valid extension and make sure it is
+                        if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
+
+                        // Save icons file
+    #if defined(SUPPORT_ICONS_AUTOSAVE)
+                        JoinIconsAutosave();    // Wait for autosave in progress, same file could be written
+    #endif
+                        SaveIcons(outFileName);
+    #if defined(SUPPORT_ICONS_JOURNAL)
+                        ResetIconsJournal(&iconsJournal, outFileName, currentIcons, guiIconsName);   // Only if saved over journaled iconset file
+    #endif
+
+                    #if defined(PLATFORM_WEB)
+                        // Download file from MEMFS (emscripten memory filesystem)
+                        // NOTE: Second argument must be a simple filename (we can't use directories)
+                        // NOTE: Included security check to (partially) avoid malicious code on PLATFORM_WEB
+                        if (strchr(outFileName, '\'') == NULL) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
+                    #endif
+                    }
 
-        EndTextureMode();
+                    if (result >= 0) showSaveFileDialog = false;
+                }
+                //----------------------------------------------------------------------------------------
 
-        BeginDrawing();
-            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+                // GUI: Export File Dialog (and saving logic)
+                //----------------------------------------------------------------------------------------
+                if (showExportFileDialog)
+                {
+    #if defined(CUSTOM_MODAL_DIALOGS)
+                    //int result = GuiFileDialog(DIALOG_TEXTINPUT, "Export raygui icons file...", outFileName, "Ok;Cancel", NULL);
+                    int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 60, 280, 112 }, "#7#Export raygui icon file...", NULL, "#7#Export", outFileName, 512, NULL);
+    #else
+                    char filters[64] = { 0 };   // Consider different supported file types
 
-            // Draw render texture to screen
-            if (screenSizeActive) DrawTexturePro(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Rectangle){ 0, 0, (float)target.texture.width*2, (float)target.texture.height*2 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
-            else DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Vector2){ 0, 0 }, WHITE);
+                    // NOTE: Default file name extension added when dialog is requested (dialog polled every frame)
+                    switch (exportFormatActive)
+                    {
+                        case 0: strcpy(filters, "*.rgi"); break;   // Icons file (.rgi)
+                        case 1: strcpy(filters, "*.png"); break;   // Icons image (.png)
+                        case 2: strcpy(filters, "*.h"); break;     // Icons code (.h)
+                        default: break;
+                    }
+
+                    int result = GuiFileDialogAsync(DIALOG_SAVE_FILE, "Export raygui icons file...", outFileName, filters, TextFormat("File type (%s)", filters));
+    #endif
+                    if (result == 1)
+                    {
+                        // Export file: outFileName
+                        switch (exportFormatActive)
+                        {
+                            case 0:
+                            {
+                                // Check for valid extension and make sure it is
+                                if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgi")) strcat(outFileName, ".rgi\0");
+                                SaveIcons(outFileName);
+                            } break;
+                            case 1:
+                            {
+                                // Check for valid extension and make sure it is
+                                if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
+                                ExportIconsAsImage(outFileName, nameIdsChunkChecked);
+                            } break;
+                            case 2:
+                            {
+                                // Check for valid extension and make sure it is
+                                if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".h")) strcat(outFileName, ".h\0");
+                                ExportIconsAsCode(outFileName);
+                            } break;
+                            default: break;
+                        }
+
+                    #if defined(PLATFORM_WEB)
+                        // Download file from MEMFS (emscripten memory filesystem)
+                        // NOTE: Second argument must be a simple filename (we can't use directories)
+                        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
+                    #endif
+                    }
+
+                    if (result >= 0) showExportFileDialog = false;
+                }
+                //----------------------------------------------------------------------------------------
+
+                // GUI: Export Icon Image Dialog (and saving logic)
+                //----------------------------------------------------------------------------------------
+                /*
+                if (showExportIconImageDialog)
+                {
+                    //strcpy(outFileName, TextFormat("%s_%ix%i.png", TextToLower(guiIconsName[selectedIcon]), RAYGUI_ICON_SIZE, RAYGUI_ICON_SIZE));
+
+    #if defined(CUSTOM_MODAL_DIALOGS)
+                    int result = GuiFileDialog(DIALOG_TEXTINPUT, "Export raygui icon as image file...", outFileName, "Ok;Cancel", NULL);
+    #else
+                    int result = GuiFileDialog(DIALOG_SAVE_FILE, "Export raygui icon as image file...", outFileName, "*.png", "Image File (*.png)");
+    #endif
+                    if (result == 1)
+                    {
+                        // Export file: outFileName
+                        // Check for valid extension and make sure it is
+                        if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".png")) strcat(outFileName, ".png\0");
+                        Image icon = GenImageFromIconData(GuiGetIconData(selectedIcon), 1, 1, 0);
+                        ExportImage(icon, outFileName);
+                        UnloadImage(icon);
+
+                        // Save icon name id into PNG tEXt chunk
+                        rpng_chunk_write_text(outFileName, "Description", guiIconsName[selectedIcon]);
+
+                    #if defined(PLATFORM_WEB)
+                        // Download file from MEMFS (emscripten memory filesystem)
+                        // NOTE: Second argument must be a simple filename (we can't use directories)
+                        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", outFileName, GetFileName(outFileName)));
+                    #endif
+                    }
+
+                    if (result >= 0) showExportIconImageDialog = false;
+                }
+                */
+                //----------------------------------------------------------------------------------------
+
+                PROFILE_END(PROFILE_WINDOWS);
+
+            EndTextureMode();
+
+            redrawFramesCounter--;
+        }
+        else GuiUnlock();   // Lock set by overlay windows is released on drawing, also on skipped frames
+
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+        // Wait for events while idle: nothing to redraw, no undo state or name id change pending to be recorded,
+        // no text box being edited (cursor blinking) and no visual style pending to be cached,
+        // EndDrawing() blocks until next event
+        bool idle = (redrawFramesCounter == 0) &&
+                    !iconNameIdEditMode && !iconsFilterEditMode && !styleNameEditMode &&
+                    (memcmp(undoIconSet[currentUndoIndex].values, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) == 0) &&
+                    (memcmp(checkedIconsName, guiIconsName, sizeof(checkedIconsName)) == 0);
+    #if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+        if (stylePreloadIndex < MAX_GUI_STYLES_AVAILABLE) idle = false;
+    #endif
+    #if defined(SUPPORT_ICONS_AUTOSAVE)
+        // NOTE: Autosave interval checked and result polled every frame, no event waiting while autosave pending
+        if (iconsAutosave.running || (saveChangesRequired && IsFileExtension(inFileName, ".rgi"))) idle = false;
+    #endif
+
+        if (idle && !eventWaiting) EnableEventWaiting();
+        else if (!idle && eventWaiting) DisableEventWaiting();
+        eventWaiting = idle;
+#endif
+
+        BeginDrawing();
+            PROFILE_BEGIN(PROFILE_PRESENT);
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            // Draw render texture to screen
+            if (screenSizeActive) DrawTexturePro(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Rectangle){ 0, 0, (float)target.texture.width*2, (float)target.texture.height*2 }, (Vector2){ 0, 0 }, 0.0f, WHITE);
+            else DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, -(float)target.texture.height }, (Vector2){ 0, 0 }, WHITE);
+            PROFILE_END(PROFILE_PRESENT);
+
+        #if defined(SUPPORT_FRAME_PROFILER)
+            // NOTE: Frame measured up to this point, overlay drawing and frame wait (EndDrawing) not included
+            ProfileFrameEnd(frameDrawn);
+            if (profiler.active) DrawProfilerOverlay();
+        #endif
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -1303,11 +1923,28 @@ int main(int argc, char *argv[])
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+    free(drawnIcons);
+#endif
+#if defined(SUPPORT_FRAME_PROFILER)
+    CloseProfilerTrace();       // Close profiler trace file (if opened)
+#endif
+
+    UnloadVisualStyles();       // Unload cached visual styles fonts
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+    JoinIconsAutosave();        // Wait for autosave in progress
+#endif
+#if defined(SUPPORT_ICONS_JOURNAL)
+    CloseIconsJournal(&iconsJournal, true);     // Exit confirmed, journal not required
+#endif
+    GuiFileDialogUnload();      // Join or detach native file dialog worker thread
+
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
     return 0;
 }
+#endif  // RGUIICONS_CLI_ONLY
 
 //--------------------------------------------------------------------------------------------
 // Module functions definition
@@ -1319,7 +1956,11 @@ static void ShowCommandLineInfo(void)
     printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
     printf("//                                                                              //\n");
     printf("// %s v%s - %s                //\n", toolName, toolVersion, toolDescription);
+#if defined(RGUIICONS_CLI_ONLY)
+    printf("// powered by raygui v%s (command-line only)                               //\n", RAYGUI_VERSION);
+#else
     printf("// powered by raylib v%s and raygui v%s                               //\n", RAYLIB_VERSION, RAYGUI_VERSION);
+#endif
     printf("// more info and bugs-report: github.com/raylibtech/rtools                      //\n");
     printf("// feedback and support:      ray[at]raylibtech.com                             //\n");
     printf("//                                                                              //\n");
@@ -1328,31 +1969,108 @@ static void ShowCommandLineInfo(void)
     printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
 
     printf("USAGE:\n\n");
-    printf("    > rguiicons [--help] --input <filename.ext> [--output <filename.ext>]\n");
+    printf("    > rguiicons [--help] --input <filename.ext> [--output <filename.ext> ...] [--output-format <ext,ext>]\n");
+    printf("    > rguiicons --dedupe <filename.rgi> [<filename.rgi> ...]\n");
+    printf("    > rguiicons --similar <filename.rgi> <icon_id> [<library.rgi> ...]\n");
+    printf("    > rguiicons --find <name_id> [<filename.rgi> ...]\n");
+#if defined(SUPPORT_WATCH_MODE)
+    printf("    > rguiicons --watch <directory> [--output-format <ext,ext>]\n");
+#endif
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
-    printf("                                      Supported extensions: .rgi\n");
-    printf("    -o, --output <filename.ext>     : Define output file.\n");
+    printf("    -i, --input <filename.ext>      : Define input file, - for standard input.\n");
+    printf("                                      Supported extensions: .rgi, .png\n");
+    printf("    -o, --output <filename.ext>     : Define output file, can be repeated (input loaded once).\n");
     printf("                                      Supported extensions: .rgi, .png, .h\n");
-    printf("                                      NOTE: If not specified, defaults to: output.rgi\n\n");
+    printf("                                      NOTE: If not specified, defaults to: output.rgi\n");
+    printf("                                      NOTE: - for standard output, format defined by\n");
+    printf("                                      --output-format (one format), defaults to: rgi\n");
+    printf("    -f, --output-format <ext,ext>   : Define output formats, comma separated, output files\n");
+    printf("                                      named as input file with format extension.\n");
+    printf("                                      Supported formats: rgi, png, h\n\n");
+    printf("    -d, --dedupe <filename.rgi> ... : Report duplicate icons (same content) across\n");
+    printf("                                      all provided iconsets, empty icons not considered\n\n");
+    printf("    -s, --similar <filename.rgi> <icon_id> [<library.rgi> ...]\n");
+    printf("                                    : Report icons most similar to provided icon\n");
+    printf("                                      (different pixels count), searched on same\n");
+    printf("                                      iconset and provided library iconsets\n\n");
+    printf("    -n, --find <name_id> [<filename.rgi> ...]\n");
+    printf("                                    : Find icons by name id (case-insensitive), icons\n");
+    printf("                                      with a name id word starting with it if not found\n");
+    printf("                                      NOTE: If no iconsets provided, default one searched\n\n");
+#if defined(SUPPORT_WATCH_MODE)
+    printf("    -w, --watch <directory>         : Watch directory, changed .rgi files reconverted to\n");
+    printf("                                      --output-format formats (png, h) next to the\n");
+    printf("                                      source file, until the process is stopped\n");
+    printf("                                      NOTE: If not specified, defaults to: png\n\n");
+#endif
+#if defined(SUPPORT_FRAME_PROFILER)
+    printf("    --trace <filename.csv> [<filename.rgi>]\n");
+    printf("                                    : Run gui interface tracing frame profiler stats\n");
+    printf("                                      (sections time, draw calls, rectangles) to file\n\n");
+#endif
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguiicons --input icons.rgi --output icons.png\n");
     printf("        Process <icons.rgi> to generate <icons.png>\n\n");
     printf("    > rguiicons --input icons.rgi --output ricons.h\n");
     printf("        Process <icons.rgi> to generate <ricons.h>\n\n");
+    printf("    > rguiicons --input icons.rgi --output-format png,h\n");
+    printf("        Process <icons.rgi> once to generate <icons.png> and <icons.h>\n\n");
+    printf("    > rguiicons --input - --output - --output-format png < icons.rgi > icons.png\n");
+    printf("        Process iconset from standard input to generate .png on standard output\n\n");
+    printf("    > rguiicons --dedupe icons/*.rgi\n");
+    printf("        Report duplicate icons across all <icons/*.rgi> iconsets\n\n");
+    printf("    > rguiicons --similar icons.rgi 12 icons/*.rgi\n");
+    printf("        Report icons similar to icon 12 of <icons.rgi> across all <icons/*.rgi> iconsets\n\n");
+    printf("    > rguiicons --find ICON_FILE_SAVE icons/*.rgi\n");
+    printf("        Find icon with name id <FILE_SAVE> on all <icons/*.rgi> iconsets\n\n");
+#if defined(SUPPORT_WATCH_MODE)
+    printf("    > rguiicons --watch icons --output-format png,h\n");
+    printf("        Watch <icons> directory, changed <*.rgi> files reconverted to <*.png> and <*.h>\n\n");
+#endif
+#if defined(SUPPORT_FRAME_PROFILER)
+    printf("    > rguiicons --trace frames.csv icons.rgi\n");
+    printf("        Edit <icons.rgi> tracing frame profiler stats to <frames.csv>\n\n");
+#endif
 }
 
 // Process command line input
-static void ProcessCommandLine(int argc, char *argv[])
+static int ProcessCommandLine(int argc, char *argv[])
 {
+    int result = 0;                     // Exit status: 1 if input could not be loaded or any output could not be written
+
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
+    const char *outputFiles[MAX_OUTPUT_FILES] = { 0 }; // Output files, input file loaded once
+    int outputFileCount = 0;
+    int outputFormats = 0;              // Output formats, output files named as input file
+    int firstOutputFormat = 0;          // First output format provided, used for standard output
+    bool stdoutOutput = false;          // Standard output used for data (-o -)
+#if defined(SUPPORT_WATCH_MODE)
+    char watchDirPath[512] = { 0 };     // Directory to watch for .rgi files changes
+#endif
+    char **dedupeFiles = NULL;          // Iconsets to check for duplicate icons
+    int dedupeFileCount = 0;
+    char **similarFiles = NULL;         // Iconsets to search for similar icons, first one contains searched icon
+    int similarFileCount = 0;
+    int similarIconId = -1;
+    char *findName = NULL;              // Icon name id to find
+    char **findFiles = NULL;            // Iconsets to find icon name id
+    int findFileCount = 0;
 
     if (argc == 1) showUsageInfo = true;
 
+    // Check standard output used for data before any message is written
+    for (int i = 1; i < (argc - 1); i++)
+    {
+        if (((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0)) && (strcmp(argv[i + 1], "-") == 0)) stdoutOutput = true;
+    }
+
+    // Messages written to standard error in case standard output is used for data
+    FILE *info = stdoutOutput? stderr : stdout;
+
     // Process command line arguments
     for (int i = 1; i < argc; i++)
     {
@@ -1362,425 +2080,1904 @@ static void ProcessCommandLine(int argc, char *argv[])
         }
         else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
         {
-            // Check for valid upcoming argument
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // Check for valid upcoming argument, - for standard input
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
                 // Check for valid file extension: input
-                if (IsFileExtension(argv[i + 1], ".rgi"))
+                if ((strcmp(argv[i + 1], "-") == 0) ||
+                    IsFileExtension(argv[i + 1], ".rgi") ||
+                    IsFileExtension(argv[i + 1], ".png"))
                 {
                     strcpy(inFileName, argv[i + 1]);    // Read input file
                 }
-                else printf("WARNING: Input file extension not recognized.\n");
+                else fprintf(info, "WARNING: Input file extension not recognized.\n");
 
                 i++;
             }
-            else printf("WARNING: No input file provided\n");
+            else fprintf(info, "WARNING: No input file provided\n");
         }
         else if ((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0))
         {
-            // Check for valid upcoming argumment and valid file extension: output
-            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            // Check for valid upcoming argumment and valid file extension: output, - for standard output
+            if (((i + 1) < argc) && ((argv[i + 1][0] != '-') || (strcmp(argv[i + 1], "-") == 0)))
             {
                 // Check for valid file extension: output
-                if (IsFileExtension(argv[i + 1], ".rgi") ||
+                if ((strcmp(argv[i + 1], "-") == 0) ||
+                    IsFileExtension(argv[i + 1], ".rgi") ||
                     IsFileExtension(argv[i + 1], ".png") ||
                     IsFileExtension(argv[i + 1], ".h"))
                 {
-                    strcpy(outFileName, argv[i + 1]);   // Read output filename
+                    if (outputFileCount < MAX_OUTPUT_FILES) outputFiles[outputFileCount++] = argv[i + 1];   // Read output filename
+                    else fprintf(info, "WARNING: Too many output files, ignored: %s\n", argv[i + 1]);
                 }
-                else printf("WARNING: Output file extension not recognized.\n");
+                else fprintf(info, "WARNING: Output file extension not recognized.\n");
+
+                i++;
+            }
+            else fprintf(info, "WARNING: No output file provided\n");
+        }
+        else if ((strcmp(argv[i], "-d") == 0) || (strcmp(argv[i], "--dedupe") == 0))
+        {
+            // All upcoming arguments (until next option) are iconsets to check
+            dedupeFiles = &argv[i + 1];
+            while (((i + 1) < argc) && (argv[i + 1][0] != '-')) { dedupeFileCount++; i++; }
+
+            if (dedupeFileCount == 0) fprintf(info, "WARNING: No input files provided for duplicates report\n");
+        }
+        else if ((strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "--similar") == 0))
+        {
+            // Check for valid upcoming arguments: iconset and icon id, then optional library iconsets
+            if (((i + 2) < argc) && (argv[i + 1][0] != '-') && (argv[i + 2][0] != '-'))
+            {
+                similarFiles = &argv[i + 1];
+                similarIconId = atoi(argv[i + 2]);
+                similarFileCount = 1;
+                i += 2;
+
+                // Library iconsets: all upcoming arguments until next option
+                // NOTE: Library files stored after searched iconset, icon id argument overwritten
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-')) { similarFiles[similarFileCount] = argv[i + 1]; similarFileCount++; i++; }
 
+                if ((similarIconId < 0) || (similarIconId >= RAYGUI_ICON_MAX_ICONS)) { fprintf(info, "WARNING: Icon id not valid: %i\n", similarIconId); similarFileCount = 0; }
+            }
+            else fprintf(info, "WARNING: No iconset and icon id provided for similar icons search\n");
+        }
+        else if ((strcmp(argv[i], "-n") == 0) || (strcmp(argv[i], "--find") == 0))
+        {
+            // Check for valid upcoming argument: name id, then optional iconsets until next option
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                findName = argv[i + 1];
+                i++;
+
+                findFiles = &argv[i + 1];
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-')) { findFileCount++; i++; }
+            }
+            else fprintf(info, "WARNING: No icon name id provided to find\n");
+        }
+#if defined(SUPPORT_WATCH_MODE)
+        else if ((strcmp(argv[i], "-w") == 0) || (strcmp(argv[i], "--watch") == 0))
+        {
+            // Check for valid upcoming argument: directory to watch
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strncpy(watchDirPath, argv[i + 1], 511);
+                i++;
+            }
+            else fprintf(info, "WARNING: No directory to watch provided\n");
+        }
+#endif
+        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--output-format") == 0))
+        {
+            // Check for valid upcoming argument: formats list
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                outputFormats = ParseOutputFormats(argv[i + 1], info, &firstOutputFormat);
                 i++;
             }
-            else printf("WARNING: No output file provided\n");
+            else fprintf(info, "WARNING: No output formats provided\n");
         }
     }
 
     // Process input file if provided
     if (inFileName[0] != '\0')
     {
+        char formatFileNames[3][512] = { 0 };
+        const int formats[3] = { OUTPUT_FORMAT_RGI, OUTPUT_FORMAT_PNG, OUTPUT_FORMAT_CODE };
+        const char *formatExts[3] = { ".rgi", ".png", ".h" };
+        bool stdinInput = (strcmp(inFileName, "-") == 0);
+        int stdoutFormat = (firstOutputFormat != 0)? firstOutputFormat : OUTPUT_FORMAT_RGI;
+
+        if (stdoutOutput)
+        {
+            // Standard output format: first output format provided (.rgi by default)
+            if ((outputFormats & (outputFormats - 1)) != 0) fprintf(info, "WARNING: Only one output format supported for standard output, using: %s\n", formatExts[(stdoutFormat == OUTPUT_FORMAT_RGI)? 0 : (stdoutFormat == OUTPUT_FORMAT_PNG)? 1 : 2]);
+        }
+        else if (stdinInput)
+        {
+            if (outputFormats != 0) fprintf(info, "WARNING: Output formats require an input file name, ignored\n");
+        }
+        else
+        {
+            // Output formats files: input file name with format extension
+            // NOTE: Input file is never overwritten by its own format
+            const char *inFileExt = strrchr(inFileName, '.');
+            int baseNameLength = (inFileExt != NULL)? (int)(inFileExt - inFileName) : (int)strlen(inFileName);
+
+            for (int i = 0; i < 3; i++)
+            {
+                if (!(outputFormats & formats[i])) continue;
+
+                if (IsFileExtension(inFileName, formatExts[i])) fprintf(info, "WARNING: Output format %s would overwrite input file, ignored\n", formatExts[i]);
+                else if (outputFileCount < MAX_OUTPUT_FILES)
+                {
+                    snprintf(formatFileNames[i], 512, "%.*s%s", baseNameLength, inFileName, formatExts[i]);
+                    outputFiles[outputFileCount++] = formatFileNames[i];
+                }
+            }
+        }
+
         // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output.rgi");
+        if ((outputFileCount == 0) && ((outputFormats == 0) || stdinInput)) outputFiles[outputFileCount++] = "output.rgi";
 
-        printf("\nInput file:       %s", inFileName);
-        printf("\nOutput file:      %s", outFileName);
+        fprintf(info, "\nInput file:       %s", stdinInput? "<stdin>" : inFileName);
+        for (int i = 0; i < outputFileCount; i++) fprintf(info, "\nOutput file:      %s", (strcmp(outputFiles[i], "-") == 0)? "<stdout>" : outputFiles[i]);
 
         // Load input file: icons data and name ids
-        char **tempIconsName = GuiLoadIcons(inFileName, true);
-        memcpy(currentIcons, guiIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) { strcpy(guiIconsName[i], tempIconsName[i]); free(tempIconsName[i]); }
-        free(tempIconsName);
+        int iconCount = 0;
+
+        if (stdinInput)
+        {
+        #if defined(_WIN32)
+            _setmode(_fileno(stdin), _O_BINARY);
+        #endif
+            // Input format detected by file signature: PNG image or raygui icons file
+            int dataSize = 0;
+            unsigned char *data = LoadStreamData(stdin, &dataSize);
 
-        // Process input --> output
-        if (IsFileExtension(outFileName, ".rgi")) SaveIcons(outFileName);
-        else if (IsFileExtension(outFileName, ".png"))
+            if (data == NULL) fprintf(info, "\nWARNING: Standard input could not be read\n");
+            else if ((dataSize >= 8) && (memcmp(data, "\x89PNG", 4) == 0)) iconCount = LoadIconsFromImageMemory(data, dataSize, 16, 1);
+            else iconCount = LoadIconsFromMemory(data, dataSize);
+
+            if (iconCount == 0) fprintf(info, "\nWARNING: Icons could not be loaded from standard input\n");
+            RL_FREE(data);
+        }
+        else if (IsFileExtension(inFileName, ".png"))
+        {
+            iconCount = LoadIconsFromImage(inFileName, 16, 1);
+            if (iconCount == 0) fprintf(info, "\nWARNING: Icons could not be loaded from image\n");
+        }
+        else
         {
-            Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
-            ExportImage(image, outFileName);
-            UnloadImage(image);
+            // NOTE: File data validated, iconsets with less icons than RAYGUI_ICON_MAX_ICONS supported
+            int dataSize = 0;
+            unsigned char *fileData = LoadFileData(inFileName, &dataSize);
+            iconCount = LoadIconsFromMemory(fileData, dataSize);
+            UnloadFileData(fileData);
+
+            if (iconCount == 0) fprintf(info, "\nWARNING: Icons could not be loaded from file\n");
+        }
+
+        if (iconCount == 0) result = 1;
 
-            // Concatenate all icons names into one string
-            char *iconsNames = (char *)RL_CALLOC(RAYGUI_ICON_MAX_ICONS*32, 1);
-            char *iconsNamesPtr = iconsNames;
-            for (int i = 0, size = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        // Process input --> outputs, input loaded once, nothing exported if no icons loaded
+        for (int i = 0; (iconCount > 0) && (i < outputFileCount); i++)
+        {
+            if (strcmp(outputFiles[i], "-") == 0)
             {
-                size = strlen(guiIconsName[i]);
-                memcpy(iconsNamesPtr, guiIconsName[i], size);
-                iconsNamesPtr[size] = ';';
-                iconsNamesPtr += (size + 1);
+            #if defined(_WIN32)
+                _setmode(_fileno(stdout), _O_BINARY);
+            #endif
+                if (ExportIconsToStream(stdout, stdoutFormat) != 0) { fprintf(info, "WARNING: Standard output could not be written\n"); result = 1; }
             }
-
-            // Save icons name id into PNG zTXt chunk
-            rpng_chunk_write_comp_text(outFileName, "Description", iconsNames);
-            RL_FREE(iconsNames);
+            else if (ExportIconsFile(outputFiles[i]) != 0) { fprintf(info, "WARNING: Output file could not be written: %s\n", outputFiles[i]); result = 1; }
         }
-        else if (IsFileExtension(outFileName, ".h")) ExportIconsAsCode(outFileName);
     }
 
-    if (showUsageInfo) ShowCommandLineInfo();
-}
-#endif      // PLATFORM_DESKTOP
+    if (dedupeFileCount > 0) ReportDuplicateIcons(dedupeFiles, dedupeFileCount);
 
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export data functions
-//--------------------------------------------------------------------------------------------
+    if (similarFileCount > 0) ReportSimilarIcons(similarFiles, similarFileCount, similarIconId);
 
-// Load icons from image file
-// NOTE: Several parameters are required for proper loading
-static void LoadIconsFromImage(Image image, int iconCount, int iconSize, int iconsPerLine, int padding)
-{
-    int lines = iconCount/iconsPerLine;
-    if (iconCount%iconsPerLine > 0) lines++;
+    if (findName != NULL) ReportIconsByName(findName, findFiles, findFileCount);
 
-    Color *pixels = LoadImageColors(image);
+    if (showUsageInfo) ShowCommandLineInfo();
+#if defined(SUPPORT_WATCH_MODE)
+    else if (watchDirPath[0] != '\0')
+    {
+        // NOTE: Converting to .rgi would overwrite watched files
+        int watchFormats = (outputFormats != 0)? outputFormats : OUTPUT_FORMAT_PNG;
+        if (watchFormats & OUTPUT_FORMAT_RGI) printf("WARNING: Output format .rgi not supported in watch mode\n");
+        watchFormats &= ~OUTPUT_FORMAT_RGI;
 
-    Rectangle icorec = { 0, 0, iconSize, iconSize };
-    Color pixel = BLACK;
+        if (watchFormats != 0) WatchIconsDirectory(watchDirPath, watchFormats);
+        else printf("WARNING: No valid output formats for watch mode\n");
+    }
+#endif
 
-    // Calculate number of bytes required
-    int size = iconsPerLine*lines*iconSize*iconSize/32;
-    unsigned int *values = (unsigned int *)calloc(size, sizeof(unsigned int));
+    return result;
+}
 
-    int n = 0;      // Icons counter
-    int k = 0;      // Bit counter
+// Report duplicate icons across multiple iconsets (.rgi)
+// NOTE: Icons are sorted by content hash (and data), duplicates are contiguous, O(n log n)
+static void ReportDuplicateIcons(char **fileNames, int fileCount)
+{
+    IconEntry *entries = (IconEntry *)RL_CALLOC(fileCount*RAYGUI_ICON_MAX_ICONS, sizeof(IconEntry));
+    int entryCount = 0;
 
-    for (int y = 0; y < lines; y++)
+    for (int f = 0; f < fileCount; f++)
     {
-        for (int x = 0; x < iconsPerLine; x++)
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileNames[f], &dataSize);
+        int iconCount = LoadIconsFromMemory(fileData, dataSize);
+        UnloadFileData(fileData);
+
+        if (iconCount == 0) printf("WARNING: Icons could not be loaded: %s\n", fileNames[f]);
+
+        for (int i = 0; i < iconCount; i++)
         {
-            // Get icon start pixel position within image (top-left corner)
-            icorec.x = padding + x*(iconSize + 2*padding);
-            icorec.y = padding + y*(iconSize + 2*padding);
+            unsigned long long hash = HashIconData(GetIconData(currentIcons, i));
+            if (hash == 0) continue;    // Empty icons not considered
+
+            IconEntry *entry = &entries[entryCount];
+            entry->hash = hash;
+            memcpy(entry->data, GetIconData(currentIcons, i), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            memcpy(entry->name, guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH);
+            entry->fileIndex = f;
+            entry->iconId = i;
+            entryCount++;
+        }
+    }
 
-            // Move along pixels within each icon area
-            for (int p = 0; p < iconSize*iconSize; p++)
-            {
-                pixel = pixels[((int)icorec.y + p/iconSize)*(iconsPerLine*(iconSize + 2*padding)) + ((int)icorec.x + p%iconSize)];
+    qsort(entries, entryCount, sizeof(IconEntry), CompareIconEntries);
 
-                if (ColorToInt(pixel) == 0xffffffff) RGI_BIT_SET(values[n*(iconSize*iconSize/32) + p/32], k);
+    int groupCount = 0;
+    int duplicateCount = 0;
+    int uniqueCount = 0;
 
-                k++;
-                if (k == 32) k = 0;
-            }
+    printf("\n");
 
-            n++;
-        }
+    for (int i = 0, groupSize = 0; i < entryCount; i += groupSize)
+    {
+        groupSize = 1;
+        while (((i + groupSize) < entryCount) && (entries[i + groupSize].hash == entries[i].hash) &&
+               (memcmp(entries[i + groupSize].data, entries[i].data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) == 0)) groupSize++;
+
+        uniqueCount++;
+        if (groupSize < 2) continue;
+
+        printf("DUPLICATE [%016llx]: %i icons\n", entries[i].hash, groupSize);
+        for (int k = i; k < (i + groupSize); k++) printf("    %s: %i - %s\n", fileNames[entries[k].fileIndex], entries[k].iconId, entries[k].name);
+
+        groupCount++;
+        duplicateCount += (groupSize - 1);
     }
 
-    UnloadImageColors(pixels);
-    UnloadImage(image);
+    printf("\nIconsets checked:   %i\n", fileCount);
+    printf("Icons (not empty):  %i\n", entryCount);
+    printf("Unique icons:       %i\n", uniqueCount);
+    printf("Duplicate groups:   %i (%i duplicate icons)\n", groupCount, duplicateCount);
+
+    RL_FREE(entries);
 }
 
-// Save raygui icons file (.rgi)
-static int SaveIcons(const char *fileName)
+// Compare icon entries by hash and data, entry position used to keep report order stable
+static int CompareIconEntries(const void *a, const void *b)
 {
-    // raygui Icons File Structure (.rgi)
-    // ------------------------------------------------------
-    // Offset  | Size    | Type       | Description
-    // ------------------------------------------------------
-    // 0       | 4       | char       | Signature: "rGI "
-    // 4       | 2       | short      | Version: 100
-    // 6       | 2       | short      | reserved
-
-    // 8       | 2       | short      | Num icons (N)
-    // 10      | 2       | short      | Icons size (Options: 16, 32, 64) (S)
-
-    // Icons name id (32 bytes per name id)
-    // foreach (icon)
-    // {
-    //   12+32*i  | 32   | char       | Icon NameId
-    // }
-
-    // Icons data: One bit per pixel, stored as unsigned int array (depends on icon size)
-    // S*S pixels/32bit per unsigned int = K unsigned int per icon
-    // foreach (icon)
-    // {
-    //   ...   | K       | unsigned int | Icon Data
-    // }
+    const IconEntry *entryA = (const IconEntry *)a;
+    const IconEntry *entryB = (const IconEntry *)b;
 
-    int result = -1;
-    FILE *rgiFile = fopen(fileName, "wb");
+    if (entryA->hash != entryB->hash) return (entryA->hash < entryB->hash)? -1 : 1;
 
-    if (rgiFile != NULL)
+    int result = memcmp(entryA->data, entryB->data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+    if (result == 0) result = (entryA->fileIndex != entryB->fileIndex)? (entryA->fileIndex - entryB->fileIndex) : (entryA->iconId - entryB->iconId);
+
+    return result;
+}
+
+// Report icons similar to one icon, across multiple iconsets (.rgi)
+// NOTE: First iconset contains searched icon, all iconsets icons are added to a BK-tree for search
+static void ReportSimilarIcons(char **fileNames, int fileCount, int iconId)
+{
+    unsigned int *icons = (unsigned int *)RL_CALLOC(fileCount*RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS, sizeof(unsigned int));
+    IconEntry *entries = (IconEntry *)RL_CALLOC(fileCount*RAYGUI_ICON_MAX_ICONS, sizeof(IconEntry));
+    int entryCount = 0;
+    int searchEntry = -1;
+
+    for (int f = 0; f < fileCount; f++)
     {
-        char signature[5] = "rGI ";
-        short version = 100;
-        short reserved = 0;
-        short iconCount = RAYGUI_ICON_MAX_ICONS;
-        short iconSize = RAYGUI_ICON_SIZE;
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileNames[f], &dataSize);
+        int iconCount = LoadIconsFromMemory(fileData, dataSize);
+        UnloadFileData(fileData);
 
-        fwrite(signature, sizeof(char), 4, rgiFile);
-        fwrite(&version, sizeof(short), 1, rgiFile);
-        fwrite(&reserved, sizeof(short), 1, rgiFile);
-        fwrite(&iconCount, sizeof(short), 1, rgiFile);
-        fwrite(&iconSize, sizeof(short), 1, rgiFile);
+        if (iconCount == 0) printf("WARNING: Icons could not be loaded: %s\n", fileNames[f]);
 
         for (int i = 0; i < iconCount; i++)
         {
-            // Write icons name id
-            fwrite(guiIconsName[i], 1, RAYGUI_ICON_MAX_NAME_LENGTH, rgiFile);
+            if ((f == 0) && (i == iconId)) searchEntry = entryCount;
+
+            memcpy(icons + entryCount*RAYGUI_ICON_DATA_ELEMENTS, GetIconData(currentIcons, i), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            memcpy(entries[entryCount].name, guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH);
+            entries[entryCount].fileIndex = f;
+            entries[entryCount].iconId = i;
+            entryCount++;
         }
+    }
 
-        for (int i = 0; i < iconCount; i++)
+    if (searchEntry >= 0)
+    {
+        IconMatch matches[SIMILAR_ICONS_COUNT] = { 0 };
+
+        clock_t startTime = clock();
+        IconsTree tree = LoadIconsTree(icons, entryCount);
+        clock_t treeTime = clock();
+        int matchCount = SearchIconsTree(tree, icons + searchEntry*RAYGUI_ICON_DATA_ELEMENTS, searchEntry, matches, SIMILAR_ICONS_COUNT);
+        clock_t searchTime = clock();
+
+        printf("\nSIMILAR TO %s: %i - %s\n", fileNames[0], iconId, entries[searchEntry].name);
+        for (int i = 0; i < matchCount; i++)
         {
-            // Write icons data
-            fwrite(GetIconData(currentIcons, i), sizeof(unsigned int), (iconSize*iconSize/32), rgiFile);
+            IconEntry *entry = &entries[matches[i].entry];
+            printf("    %s: %i - %s (distance: %i)\n", fileNames[entry->fileIndex], entry->iconId, entry->name, matches[i].distance);
         }
 
-        fclose(rgiFile);
-        result = 0;
+        printf("\nIconsets searched:  %i\n", fileCount);
+        printf("Icons (not empty):  %i\n", tree.nodeCount);
+        printf("Tree build time:    %.3f ms\n", (double)(treeTime - startTime)*1000.0/CLOCKS_PER_SEC);
+        printf("Search time:        %.3f ms\n", (double)(searchTime - treeTime)*1000.0/CLOCKS_PER_SEC);
+
+        UnloadIconsTree(tree);
     }
+    else printf("WARNING: Icon %i could not be loaded from: %s\n", iconId, fileNames[0]);
 
-    return result;
+    RL_FREE(entries);
+    RL_FREE(icons);
 }
 
-// Export gui icons as code (.h)
-static void ExportIconsAsCode(const char *fileName)
+// Report icons found by name id, default iconset if no files provided
+// NOTE: Exact name id match reported, otherwise icons with a name id word starting with provided text
+static void ReportIconsByName(const char *name, char **fileNames, int fileCount)
 {
-    FILE *codeFile = fopen(fileName, "wt");
-
-    if (codeFile != NULL)
-    {
-        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// raygui Icons exporter v1.1 - Icons data exported as a values array           //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
-        fprintf(codeFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "// Copyright (c) 2019-2025 raylib technologies (@raylibtech)                    //\n");
-        fprintf(codeFile, "//                                                                              //\n");
-        fprintf(codeFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Defines and Macros\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "#define RAYGUI_ICON_SIZE             %i   // Size of icons (squared)\n", RAYGUI_ICON_SIZE);
-        fprintf(codeFile, "#define RAYGUI_ICON_MAX_ICONS       %i   // Maximum number of icons\n", RAYGUI_ICON_MAX_ICONS);
-        fprintf(codeFile, "#define RAYGUI_ICON_MAX_NAME_LENGTH  %i   // Maximum length of icon name id\n\n", RAYGUI_ICON_MAX_NAME_LENGTH);
-
-        fprintf(codeFile, "// Icons data is defined by bit array (every bit represents one pixel)\n");
-        fprintf(codeFile, "// Those arrays are stored as unsigned int data arrays, so every array\n");
-        fprintf(codeFile, "// element defines 32 pixels (bits) of information\n");
-        fprintf(codeFile, "// Number of elemens depend on RAYGUI_ICON_SIZE (by default 16x16 pixels)\n");
-        fprintf(codeFile, "#define RAYGUI_ICON_DATA_ELEMENTS   (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32)\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Icons enumeration\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-
-        fprintf(codeFile, "typedef enum {\n");
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++) fprintf(codeFile, "    ICON_%-24s = %i,\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i), i);
-        fprintf(codeFile, "} guiIconName;\n\n");
-
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-        fprintf(codeFile, "// Icons data\n");
-        fprintf(codeFile, "//----------------------------------------------------------------------------------\n");
-
-        fprintf(codeFile, "static unsigned int guiIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = {\n");
-        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
-        {
-            unsigned int *icon = GetIconData(currentIcons, i);
+    static IconsNameIndex index = { 0 };
+    bool matches[RAYGUI_ICON_MAX_ICONS] = { 0 };
+    int foundCount = 0;
 
-            fprintf(codeFile, "    ");
-            for (int j = 0; j < RAYGUI_ICON_DATA_ELEMENTS; j++) fprintf(codeFile, "0x%08x, ", icon[j]);
+    printf("\n");
 
-            fprintf(codeFile, "     // ICON_%s\n", (guiIconsName[i][0] != '\0')? guiIconsName[i] : TextFormat("%03i", i));
-        }
-        fprintf(codeFile, "};\n\n");
+    for (int f = 0; f < ((fileCount > 0)? fileCount : 1); f++)
+    {
+        const char *fileName = (fileCount > 0)? fileNames[f] : "default";
+        int iconCount = RAYGUI_ICON_MAX_ICONS;
 
-        fprintf(codeFile, "// NOTE: A pointer to the current icons array should be defined\n");
-        fprintf(codeFile, "static unsigned int *guiIconsPtr = guiIcons;\n");
+        if (fileCount > 0)
+        {
+            int dataSize = 0;
+            unsigned char *fileData = LoadFileData(fileNames[f], &dataSize);
+            iconCount = LoadIconsFromMemory(fileData, dataSize);
+            UnloadFileData(fileData);
 
-        fclose(codeFile);
-    }
-}
+            if (iconCount == 0) { printf("WARNING: Icons could not be loaded: %s\n", fileName); continue; }
+        }
 
-//--------------------------------------------------------------------------------------------
-// Auxiliar functions
-//--------------------------------------------------------------------------------------------
+        // NOTE: Index updated incrementally, only name ids different from previous iconset indexed again,
+        // icons over file icons count are not indexed
+        UpdateIconsNameIndex(&index, guiIconsName, iconCount);
 
-// Draw selected icon from iconset
-static void DrawIcon(unsigned int *iconset, int iconId, int posX, int posY, int pixelSize, Color color)
-{
-    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-    {
-        for (int k = 0; k < 32; k++)
+        int iconId = FindIconByName(&index, name);
+
+        if (iconId >= 0)
+        {
+            printf("FOUND %s: %i - %s\n", fileName, iconId, guiIconsName[iconId]);
+            foundCount++;
+        }
+        else if (FilterIconsByName(&index, name, matches) > 0)
         {
-            if (RGI_BIT_CHECK(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
             {
-                // NOTE: We draw the icon pixel-by-pixel using rectangles
-                DrawRectangle(posX + (k%RAYGUI_ICON_SIZE)*pixelSize, posY + y*pixelSize, pixelSize, pixelSize, color);
+                if (matches[i]) { printf("PARTIAL %s: %i - %s\n", fileName, i, guiIconsName[i]); foundCount++; }
             }
-
-            if ((k == 15) || (k == 31)) y++;
         }
     }
+
+    if (foundCount == 0) printf("Icon name id not found: %s\n", name);
 }
 
-// Draw one icon directly providing the full icon data
-static void DrawIconData(unsigned int *data, int x, int y, int pixelSize, Color color)
+// Parse output formats list (i.e. "png,h"), returns OutputFormat flags
+// NOTE: First valid format provided is also returned, warnings written to info stream
+static int ParseOutputFormats(const char *formats, FILE *info, int *firstFormat)
 {
-    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
+    int result = 0;
+    int count = 0;
+    const char **items = TextSplit(formats, ',', &count);
+
+    *firstFormat = 0;
 
-    for (int i = 0, j = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+    for (int i = 0; i < count; i++)
     {
-        for (int k = 0; k < 32; k++)
-        {
-            if (RGI_BIT_CHECK(data[i], k))
-            {
-                // NOTE: We draw the icon pixel-by-pixel using rectangles
-                DrawRectangle(x + (k%RAYGUI_ICON_SIZE)*pixelSize, y + j*pixelSize, pixelSize, pixelSize, color);
-            }
+        const char *format = (items[i][0] == '.')? items[i] + 1 : items[i];
+        int flag = 0;
 
-            if ((k == 15) || (k == 31)) j++;
-        }
+        if (strcmp(format, "rgi") == 0) flag = OUTPUT_FORMAT_RGI;
+        else if (strcmp(format, "png") == 0) flag = OUTPUT_FORMAT_PNG;
+        else if (strcmp(format, "h") == 0) flag = OUTPUT_FORMAT_CODE;
+        else fprintf(info, "WARNING: Output format not recognized: %s\n", items[i]);
+
+        if (*firstFormat == 0) *firstFormat = flag;
+        result |= flag;
     }
+
+    return result;
 }
 
-// Gen GRAYSCALE image from and array of bits stored as int (0-BLANK, 1-WHITE)
-static Image GenImageFromIconData(unsigned int *icons, int iconCount, int iconsPerLine, int padding)
+// Export icons to file, format defined by extension (.rgi, .png, .h)
+static int ExportIconsFile(const char *fileName)
 {
-    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
-
-    Image image = { 0 };
+    int result = -1;
 
-    int lines = iconCount/iconsPerLine;
-    if (iconCount%iconsPerLine > 0) lines++;
+    if (IsFileExtension(fileName, ".rgi")) result = SaveIcons(fileName);
+    else if (IsFileExtension(fileName, ".png")) result = ExportIconsAsImage(fileName, true);
+    else if (IsFileExtension(fileName, ".h")) result = ExportIconsAsCode(fileName);
 
-    image.width = (RAYGUI_ICON_SIZE + 2*padding)*iconsPerLine;
-    image.height = (RAYGUI_ICON_SIZE + 2*padding)*lines;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-    image.data = (unsigned char *)calloc(image.width*image.height, 1);  // All pixels BLACK by default
+    return result;
+}
 
-    int pixelX = 0;
-    int pixelY = 0;
+// Export icons to stream (i.e. stdout), OutputFormat provided
+// NOTE: PNG image serialized to memory first, no temporary files required
+static int ExportIconsToStream(FILE *stream, int format)
+{
+    int result = -1;
 
-    for (int n = 0; n < iconCount; n++)
+    if (format == OUTPUT_FORMAT_RGI) result = SaveIconsToStream(stream, currentIcons, guiIconsName);
+    else if (format == OUTPUT_FORMAT_PNG)
     {
-        for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
-        {
-            for (int k = 0; k < 32; k++)
-            {
-                pixelX = padding + (n%iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + (k%RAYGUI_ICON_SIZE);
-                pixelY = padding + (n/iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + y;
-
-                if (RGI_BIT_CHECK(icons[n*RAYGUI_ICON_DATA_ELEMENTS + i], k)) ((unsigned char *)image.data)[pixelY*image.width + pixelX] = 0xff;    // Draw pixel WHITE
+        int dataSize = 0;
+        char *data = ExportIconsAsImageToMemory(true, &dataSize);
 
-                if ((k == (RAYGUI_ICON_SIZE - 1)) || (k == 31)) y++;  // Move to next pixels line
-            }
+        if (data != NULL)
+        {
+            if ((int)fwrite(data, 1, dataSize, stream) == dataSize) result = 0;
+            RPNG_FREE(data);
         }
     }
+    else if (format == OUTPUT_FORMAT_CODE) result = ExportIconsAsCodeToStream(stream);
 
-    return image;
+    if (fflush(stream) != 0) result = -1;
+
+    return result;
 }
 
-// Converts an image to bits array following: Alpha->0, NoAlpha->1
-// Very useful to store 1bit color images in an efficient (and quite secure) way
-// NOTE: Image size MUST be multiple of 8 for correct fit
-static unsigned char *ImageToBits(Image image)
+// Load stream data until end (i.e. stdin), memory must be freed
+// NOTE: Returns NULL if stream could not be fully read, partial data is never returned
+static unsigned char *LoadStreamData(FILE *stream, int *dataSize)
 {
-    Color *pixels = LoadImageColors(image);
-
-    // Calculate number of bytes required
-    int size = image.width*image.height/8;
-
-    unsigned char *bytes = (unsigned char *)calloc(size, sizeof(unsigned char));
+    int capacity = 16*1024;
+    unsigned char *data = (unsigned char *)RL_CALLOC(capacity, 1);
+    *dataSize = 0;
 
-    for (int i = 0; i < size; i++)
+    while (data != NULL)
     {
-        for (int k = 0; k < 8; k++)
+        *dataSize += (int)fread(data + *dataSize, 1, capacity - *dataSize, stream);
+
+        if (*dataSize < capacity)
         {
-            if (ColorToInt(pixels[i]) >= 0x000000ff) RGI_BIT_SET(bytes[i + k], k);
+            // Stream end reached, read errors discard data
+            if (ferror(stream)) { RL_FREE(data); data = NULL; }
+            break;
         }
+
+        unsigned char *temp = (capacity <= INT_MAX/2)? (unsigned char *)RL_REALLOC(data, capacity*2) : NULL;
+
+        if (temp == NULL) { RL_FREE(data); data = NULL; break; }
+
+        data = temp;
+        capacity *= 2;
     }
 
-    UnloadImageColors(pixels);
+    if (data == NULL) *dataSize = 0;
 
-    return bytes;
+    return data;
 }
 
-// Generate color-alpha image from and array of bits, stored in bytes
-// NOTE: 0-BLANK, 1-color
-static Image GenImageFromBits(unsigned char *bytes, int width, int height, Color color)
+#if defined(SUPPORT_WATCH_MODE)
+
+// Watch directory .rgi files, changed files reconverted to requested formats (next to source file)
+// NOTE: Bursts of writes are debounced, changed files are converted once no new events
+// are received for WATCH_DEBOUNCE_TIME; file buffer and deflate state reused between conversions
+static void WatchIconsDirectory(const char *dirPath, int formats)
 {
-    Image image = { 0 };
+    int notifyFd = inotify_init1(IN_CLOEXEC);
 
-    image.width = width;
-    image.height = height;
-    image.mipmaps = 1;
-    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-    image.data = (Color *)calloc(image.width*image.height, sizeof(Color));
+    if (notifyFd < 0)
+    {
+        printf("WARNING: Files changes notification not available\n");
+        return;
+    }
 
-    for (int i = 0; i < width*height/8; i++)
+    // NOTE: Files saved by replacement (temp file renamed over destination) notified as IN_MOVED_TO
+    if (inotify_add_watch(notifyFd, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
     {
-        for (int k = 0; k < 8; k++)
-        {
-            if (RGI_BIT_CHECK(bytes[i], k)) ((Color *)image.data)[i + k] = color;
-        }
+        printf("WARNING: Directory could not be watched: %s\n", dirPath);
+        close(notifyFd);
+        return;
     }
 
-    return image;
-}
+    static char pendingFiles[WATCH_MAX_PENDING_FILES][256] = { 0 };
+    int pendingCount = 0;
+    long long lastEventTime = 0;
 
-// Get icon bit data
-// NOTE: Bit data array grouped as unsigned int (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
-unsigned int *GetIconData(unsigned int *iconset, int iconId)
-{
-    static unsigned int iconData[RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
-    memset(iconData, 0, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    unsigned int eventsBuffer[1024] = { 0 };    // Events buffer, aligned for struct inotify_event
+    unsigned char *fileData = NULL;             // File data buffer, grown on demand and reused
+    int fileDataCapacity = 0;
 
-    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(iconData, &iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    rpng_set_deflate_state_cache(true);
 
-    return iconData;
-}
+    printf("\nWatching directory: %s (.rgi files)\n", dirPath);
 
-// Set icon bit data
-// NOTE: Data must be provided as unsigned int array (RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32 elements)
-void SetIconData(unsigned int *iconset, int iconId, unsigned int *data)
-{
-    if (iconId < RAYGUI_ICON_MAX_ICONS) memcpy(&iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS], data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
-}
+    while (true)
+    {
+        // Wait for events, timeout only required while changes are pending
+        int timeout = -1;
+        if (pendingCount > 0)
+        {
+            timeout = WATCH_DEBOUNCE_TIME - (int)(GetWatchTime() - lastEventTime);
+            if (timeout < 0) timeout = 0;
+        }
 
-// Set icon pixel value
-void SetIconPixel(unsigned int *iconset, int iconId, int x, int y)
-{
-    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
-    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
-    RGI_BIT_SET(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
-}
+        struct pollfd pollFd = { notifyFd, POLLIN, 0 };
+        int ready = poll(&pollFd, 1, timeout);
 
-// Clear icon pixel value
-void ClearIconPixel(unsigned int *iconset, int iconId, int x, int y)
-{
-    // This logic works for any RAYGUI_ICON_SIZE pixels icons,
-    // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
-    RGI_BIT_CLEAR(iconset[iconId*RAYGUI_ICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RAYGUI_ICON_SIZE)*RAYGUI_ICON_SIZE));
-}
+        if (ready < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        }
 
-// Check icon pixel value
-bool CheckIconPixel(unsigned int *iconset, int iconId, int x, int y)
-{
-    return (RGI_BIT_CHECK(iconset[iconId*8 + y/2], x + (y%2*16)));
-}
+        bool flushPending = false;
+
+        if (ready > 0)
+        {
+            int length = (int)read(notifyFd, eventsBuffer, sizeof(eventsBuffer));
+
+            for (int offset = 0; offset < length; )
+            {
+                struct inotify_event *event = (struct inotify_event *)((char *)eventsBuffer + offset);
+                offset += (int)sizeof(struct inotify_event) + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW) printf("WARNING: Files changes notifications lost\n");
+                if ((event->len == 0) || !IsFileExtension(event->name, ".rgi") || (strlen(event->name) >= 256)) continue;
+
+                // Add changed file to pending list (if not already pending)
+                bool pending = false;
+                for (int i = 0; (i < pendingCount) && !pending; i++) pending = (strcmp(pendingFiles[i], event->name) == 0);
+
+                if (!pending)
+                {
+                    strcpy(pendingFiles[pendingCount], event->name);
+                    pendingCount++;
+                    if (pendingCount == WATCH_MAX_PENDING_FILES) flushPending = true;
+                }
+            }
+
+            lastEventTime = GetWatchTime();
+        }
+
+        // Reconvert changed files once writes burst is over
+        if ((pendingCount > 0) && (flushPending || ((GetWatchTime() - lastEventTime) >= WATCH_DEBOUNCE_TIME)))
+        {
+            for (int i = 0; i < pendingCount; i++)
+            {
+                char filePath[512] = { 0 };
+                if (snprintf(filePath, 512, "%s/%s", dirPath, pendingFiles[i]) >= 512) continue;
+
+                // Load file data into reused buffer
+                // NOTE: File could have been removed or renamed after notification
+                FILE *file = fopen(filePath, "rb");
+                if (file == NULL) continue;
+
+                fseek(file, 0, SEEK_END);
+                int dataSize = (int)ftell(file);
+                fseek(file, 0, SEEK_SET);
+
+                if (dataSize > fileDataCapacity)
+                {
+                    unsigned char *data = (unsigned char *)RL_REALLOC(fileData, dataSize);
+                    if (data != NULL) { fileData = data; fileDataCapacity = dataSize; }
+                }
+
+                if (dataSize <= fileDataCapacity) dataSize = (int)fread(fileData, 1, dataSize, file);
+                else dataSize = 0;
+                fclose(file);
+
+                if (LoadIconsFromMemory(fileData, dataSize) > 0)
+                {
+                    // Output file name: source file name with output format extension
+                    char outPath[512] = { 0 };
+                    int basePathLength = (int)strlen(filePath) - 4;     // Remove ".rgi"
+
+                    if (formats & OUTPUT_FORMAT_PNG)
+                    {
+                        snprintf(outPath, 512, "%.*s.png", basePathLength, filePath);
+                        if (ExportIconsAsImage(outPath, true) == 0) printf("Converted: %s -> %s\n", filePath, outPath);
+                        else printf("WARNING: Output file could not be written: %s\n", outPath);
+                    }
+
+                    if (formats & OUTPUT_FORMAT_CODE)
+                    {
+                        snprintf(outPath, 512, "%.*s.h", basePathLength, filePath);
+                        if (ExportIconsAsCode(outPath) == 0) printf("Converted: %s -> %s\n", filePath, outPath);
+                        else printf("WARNING: Output file could not be written: %s\n", outPath);
+                    }
+                }
+                else printf("WARNING: Icons could not be loaded: %s\n", filePath);
+            }
+
+            fflush(stdout);
+            pendingCount = 0;
+        }
+    }
+
+    RL_FREE(fileData);
+    rpng_set_deflate_state_cache(false);
+    close(notifyFd);
+}
+
+// Get monotonic time in milliseconds
+static long long GetWatchTime(void)
+{
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (long long)now.tv_sec*1000 + now.tv_nsec/1000000;
+}
+#endif      // SUPPORT_WATCH_MODE
+#endif      // PLATFORM_DESKTOP
+
+#if !defined(RGUIICONS_CLI_ONLY)
+//--------------------------------------------------------------------------------------------
+// Visual styles functions
+//--------------------------------------------------------------------------------------------
+
+// Load visual style
+// NOTE: First time a style is loaded its font atlas is decompressed and uploaded to GPU,
+// style properties and font are cached, next loads just restore them (no allocations, no uploads)
+static void LoadVisualStyle(int style)
+{
+    if ((style < 0) || (style >= MAX_GUI_STYLES_AVAILABLE)) return;
+
+    // Unload current font if not cached by any style (i.e. loaded from .rgs file)
+    Font currentFont = GuiGetFont();
+    bool fontCached = (currentFont.texture.id == GetFontDefault().texture.id);
+    for (int i = 0; (i < MAX_GUI_STYLES_AVAILABLE) && !fontCached; i++)
+    {
+        if (visualStyles[i].loaded && (visualStyles[i].font.texture.id == currentFont.texture.id)) fontCached = true;
+    }
+
+    if (!fontCached)
+    {
+        UnloadFont(currentFont);
+        GuiSetFont(GetFontDefault());
+    }
+
+    VisualStyle *visualStyle = &visualStyles[style];
+
+    if (!visualStyle->loaded) CacheVisualStyle(style);
+
+    // Restore cached style properties
+    // NOTE: DEFAULT control is restored first, its base properties are propagated to all controls
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        {
+            GuiSetStyle(i, j, visualStyle->props[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j]);
+        }
+    }
+
+    GuiSetFont(visualStyle->font);
+    SetShapesTexture(visualStyle->font.texture, visualStyle->shapesRec);
+}
+
+// Decode visual style into cache, current style is kept
+// NOTE: Style font atlas is decompressed (or taken from background decompression) and uploaded to GPU
+static void CacheVisualStyle(int style)
+{
+    if ((style < 0) || (style >= MAX_GUI_STYLES_AVAILABLE) || visualStyles[style].loaded) return;
+
+    VisualStyle *visualStyle = &visualStyles[style];
+
+    // Keep current style to be restored after decoding
+    int currentProps[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        {
+            currentProps[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] = GuiGetStyle(i, j);
+        }
+    }
+
+    Font currentFont = GuiGetFont();
+    Texture2D currentShapesTexture = GetShapesTexture();
+    Rectangle currentShapesRec = GetShapesTextureRectangle();
+
+    // NOTE: Default font is set before reseting style,
+    // GuiLoadStyleDefault() unloads current font otherwise
+    GuiSetFont(GetFontDefault());
+    GuiLoadStyleDefault();
+
+    switch (style)
+    {
+        case 1: GuiLoadStyleJungle(); break;
+        case 2: GuiLoadStyleCandy(); break;
+        case 3: GuiLoadStyleLavanda(); break;
+        case 4: GuiLoadStyleCyber(); break;
+        case 5: GuiLoadStyleTerminal(); break;
+        case 6: GuiLoadStyleAshes(); break;
+        case 7: GuiLoadStyleBluish(); break;
+        case 8: GuiLoadStyleDark(); break;
+        case 9: GuiLoadStyleCherry(); break;
+        case 10: GuiLoadStyleSunny(); break;
+        case 11: GuiLoadStyleEnefete(); break;
+        case 12: GuiLoadStyleAmber(); break;
+        case 13: GuiLoadStyleGenesis(); break;
+        default: break;
+    }
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        {
+            visualStyle->props[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] = GuiGetStyle(i, j);
+        }
+    }
+
+    visualStyle->font = GuiGetFont();
+
+    if (style == 0)
+    {
+        // NOTE: Default raylib font character 95 is a white square, 1px padding to avoid bleeding
+        Rectangle whiteChar = visualStyle->font.recs[95];
+        visualStyle->shapesRec = (Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 };
+    }
+    else visualStyle->shapesRec = GetShapesTextureRectangle();
+
+    visualStyle->loaded = true;
+
+    // Restore current style
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+    {
+        for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        {
+            GuiSetStyle(i, j, currentProps[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j]);
+        }
+    }
+
+    GuiSetFont(currentFont);
+    SetShapesTexture(currentShapesTexture, currentShapesRec);
+}
+
+// Unload all cached visual styles
+static void UnloadVisualStyles(void)
+{
+    Font currentFont = GuiGetFont();
+    bool fontCached = false;
+
+    for (int i = 0; i < MAX_GUI_STYLES_AVAILABLE; i++)
+    {
+        if (visualStyles[i].loaded)
+        {
+            if (visualStyles[i].font.texture.id == currentFont.texture.id) fontCached = true;
+
+            // NOTE: UnloadFont() skips default font
+            UnloadFont(visualStyles[i].font);
+            visualStyles[i].loaded = false;
+        }
+    }
+
+    if (!fontCached) UnloadFont(currentFont);
+
+    GuiSetFont(GetFontDefault());
+
+    // Unload styles font atlas data not handed over to styles loading
+    WaitStylesFontData();
+
+    for (int i = 0; i < MAX_GUI_STYLES_AVAILABLE; i++)
+    {
+        MemFree(stylesFontData[i].data);
+        stylesFontData[i].data = NULL;
+    }
+}
+
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+// Styles font atlas decompression worker
+// NOTE: Every thread processes its own styles: first, first + threadCount...
+static void StylesFontDataWorker(void *arg)
+{
+    int first = (int)(size_t)arg;
+
+    for (int i = first; i < MAX_GUI_STYLES_AVAILABLE; i += MAX_STYLES_LOADING_THREADS)
+    {
+        if (stylesFontData[i].compData != NULL) stylesFontData[i].data = DecompressData(stylesFontData[i].compData, stylesFontData[i].compDataSize, &stylesFontData[i].dataSize);
+    }
+}
+#endif
+
+// Start styles font atlas decompression on background threads
+// NOTE: Decompressed data is only accessed after threads are joined
+static void LoadStylesFontDataAsync(void)
+{
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+    if (stylesLoadingThreadCount > 0) return;
+
+    for (int i = 0; i < MAX_STYLES_LOADING_THREADS; i++)
+    {
+        // In case thread can not be created, its styles are processed right now
+        if (StartWorkerThread(&stylesLoadingThreads[stylesLoadingThreadCount], StylesFontDataWorker, (void *)(size_t)i)) stylesLoadingThreadCount++;
+        else StylesFontDataWorker((void *)(size_t)i);
+    }
+#endif
+}
+
+// Wait for styles font atlas decompression to finish
+static void WaitStylesFontData(void)
+{
+#if defined(SUPPORT_STYLES_BACKGROUND_LOADING)
+    for (int i = 0; i < stylesLoadingThreadCount; i++) JoinWorkerThread(&stylesLoadingThreads[i]);
+
+    stylesLoadingThreadCount = 0;
+#endif
+}
+
+// Decompress style font atlas data
+// NOTE: Used by styles loading functions, data decompressed on background is handed over if available
+static unsigned char *DecompressStyleFontData(const unsigned char *compData, int compDataSize, int *dataSize)
+{
+    WaitStylesFontData();
+
+    for (int i = 0; i < MAX_GUI_STYLES_AVAILABLE; i++)
+    {
+        if ((stylesFontData[i].compData == compData) && (stylesFontData[i].data != NULL))
+        {
+            unsigned char *data = stylesFontData[i].data;
+            *dataSize = stylesFontData[i].dataSize;
+
+            stylesFontData[i].data = NULL;
+            stylesFontData[i].dataSize = 0;
+
+            return data;
+        }
+    }
+
+    return DecompressData(compData, compDataSize, dataSize);
+}
+#endif  // !RGUIICONS_CLI_ONLY
+
+#if defined(SUPPORT_FRAME_PROFILER)
+//--------------------------------------------------------------------------------------------
+// Frame profiler functions
+//--------------------------------------------------------------------------------------------
+
+// Begin section timing and counting
+static void ProfileBegin(int section)
+{
+    profiler.sectionStartTime[section] = GetTime();
+    profiler.sectionStartDrawCalls[section] = profileDrawCalls;
+    profiler.sectionStartRectangles[section] = profileRectangles;
+}
+
+// End section timing and counting
+// NOTE: Stats are accumulated in case section is measured multiple times per frame
+static void ProfileEnd(int section)
+{
+    profiler.sections[section].time += (GetTime() - profiler.sectionStartTime[section]);
+    profiler.sections[section].drawCalls += (profileDrawCalls - profiler.sectionStartDrawCalls[section]);
+    profiler.sections[section].rectangles += (profileRectangles - profiler.sectionStartRectangles[section]);
+}
+
+// Begin frame profiling, current frame stats reset
+static void ProfileFrameBegin(void)
+{
+    for (int i = 0; i < PROFILE_SECTION_COUNT; i++)
+    {
+        profiler.sections[i].time = 0.0;
+        profiler.sections[i].drawCalls = 0;
+        profiler.sections[i].rectangles = 0;
+    }
+
+    profileDrawCalls = 0;
+    profileRectangles = 0;
+
+    ProfileBegin(PROFILE_FRAME);
+}
+
+// End frame profiling, stats averaged and traced
+// NOTE: Only drawn frames are averaged, skipped frames are traced anyway
+static void ProfileFrameEnd(bool drawn)
+{
+    ProfileEnd(PROFILE_FRAME);
+
+    if (drawn)
+    {
+        for (int i = 0; i < PROFILE_SECTION_COUNT; i++) profiler.sections[i].timeSum += profiler.sections[i].time;
+        profiler.averageFrames++;
+
+        if (profiler.averageFrames >= PROFILER_AVERAGE_FRAMES)
+        {
+            for (int i = 0; i < PROFILE_SECTION_COUNT; i++)
+            {
+                profiler.sections[i].timeAverage = profiler.sections[i].timeSum/profiler.averageFrames;
+                profiler.sections[i].timeSum = 0.0;
+            }
+
+            profiler.averageFrames = 0;
+        }
+    }
+
+    if (profiler.traceFile != NULL)
+    {
+        fprintf(profiler.traceFile, "%u,%i", profiler.frameIndex, drawn);
+        for (int i = 0; i < PROFILE_SECTION_COUNT; i++) fprintf(profiler.traceFile, ",%.4f,%i,%i", profiler.sections[i].time*1000.0, profiler.sections[i].drawCalls, profiler.sections[i].rectangles);
+        fprintf(profiler.traceFile, "\n");
+    }
+
+    profiler.frameIndex++;
+}
+
+// Open profiler trace file (.csv), header written
+// NOTE: One line per frame, time (ms), draw calls and rectangles per section
+static bool OpenProfilerTrace(const char *fileName)
+{
+    profiler.traceFile = fopen(fileName, "wt");
+
+    if (profiler.traceFile != NULL)
+    {
+        fprintf(profiler.traceFile, "frame,drawn");
+        for (int i = 0; i < PROFILE_SECTION_COUNT; i++) fprintf(profiler.traceFile, ",%s_ms,%s_calls,%s_rects", profileSectionNames[i], profileSectionNames[i], profileSectionNames[i]);
+        fprintf(profiler.traceFile, "\n");
+    }
+
+    return (profiler.traceFile != NULL);
+}
+
+// Close profiler trace file
+static void CloseProfilerTrace(void)
+{
+    if (profiler.traceFile != NULL) fclose(profiler.traceFile);
+    profiler.traceFile = NULL;
+}
+
+// Draw profiler overlay
+// NOTE: Averaged sections time, current frame draw calls and rectangles
+static void DrawProfilerOverlay(void)
+{
+    const int posX = GetScreenWidth() - 270;
+    const int posY = 50;
+
+    DrawRectangle(posX, posY, 260, 34 + PROFILE_SECTION_COUNT*14, Fade(BLACK, 0.8f));
+    DrawText(TextFormat("FRAME PROFILER - %i FPS", GetFPS()), posX + 8, posY + 8, 10, GREEN);
+
+    for (int i = 0; i < PROFILE_SECTION_COUNT; i++)
+    {
+        int lineY = posY + 26 + i*14;
+        Color color = (i == PROFILE_FRAME)? YELLOW : RAYWHITE;
+
+        DrawText(profileSectionNames[i], posX + 8, lineY, 10, color);
+        DrawText(TextFormat("%.3f ms", profiler.sections[i].timeAverage*1000.0), posX + 90, lineY, 10, color);
+        DrawText(TextFormat("%i calls", profiler.sections[i].drawCalls), posX + 150, lineY, 10, color);
+        DrawText(TextFormat("%i rects", profiler.sections[i].rectangles), posX + 205, lineY, 10, color);
+    }
+}
+#endif
+
+#if defined(SUPPORT_ICONS_JOURNAL)
+//--------------------------------------------------------------------------------------------
+// Icons journal functions
+//--------------------------------------------------------------------------------------------
+
+// Icons journal File Structure (<file>.rgi.journal)
+// ------------------------------------------------------
+// Offset  | Size    | Type       | Description
+// ------------------------------------------------------
+// 0       | 4       | char       | Signature: "rGIJ"
+// 4       | 2       | short      | Version: 100
+// 6       | 2       | short      | reserved
+// 8       | 4       | int        | Iconset file checksum (FNV-1a)
+
+// Journal records, appended (one record per changed icon)
+// foreach (record)
+// {
+//   ...   | 4       | int        | Sequence number
+//   ...   | 2       | short      | Icon id
+//   ...   | 2       | short      | reserved
+//   ...   | K*4     | int        | Icon data
+//   ...   | 32      | char       | Icon name id
+//   ...   | 4       | int        | Record checksum (FNV-1a)
+// }
+
+// Open icons journal for iconset file, unsaved changes replayed over current iconset
+// NOTE: Current iconset is expected to be the iconset file just loaded, previous journal is removed,
+// records are replayed in sequence order until first invalid record (torn write) and journal compacted
+static int OpenIconsJournal(IconsJournal *journal, const char *fileName)
+{
+    int replayed = 0;
+
+    CloseIconsJournal(journal, true);
+
+    snprintf(journal->iconsFileName, sizeof(journal->iconsFileName), "%s", fileName);
+    snprintf(journal->fileName, sizeof(journal->fileName), "%s.journal", fileName);
+    journal->baseChecksum = GetIconsFileChecksum(fileName);
+    memcpy(journal->baseIcons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(journal->baseNames, guiIconsName, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_MAX_NAME_LENGTH);
+
+    FILE *file = fopen(journal->fileName, "rb");
+
+    if (file != NULL)
+    {
+        IconsJournalHeader header = { 0 };
+
+        // Journal discarded if iconset file changed after journal creation
+        if ((fread(&header, sizeof(IconsJournalHeader), 1, file) == 1) && (memcmp(header.signature, "rGIJ", 4) == 0) &&
+            (header.version == 100) && (header.baseChecksum == journal->baseChecksum))
+        {
+            IconsJournalRecord record = { 0 };
+            unsigned int sequence = 0;
+
+            while (fread(&record, sizeof(IconsJournalRecord), 1, file) == 1)
+            {
+                if ((record.checksum != ComputeJournalChecksum(&record, sizeof(IconsJournalRecord) - sizeof(unsigned int))) ||
+                    (record.sequence <= sequence) || (record.iconId >= RAYGUI_ICON_MAX_ICONS)) break;
+
+                SetIconData(currentIcons, record.iconId, record.data);
+                memcpy(guiIconsName[record.iconId], record.name, RAYGUI_ICON_MAX_NAME_LENGTH);
+                guiIconsName[record.iconId][RAYGUI_ICON_MAX_NAME_LENGTH - 1] = '\0';
+
+                sequence = record.sequence;
+                replayed++;
+            }
+        }
+
+        fclose(file);
+    }
+
+    memcpy(journal->icons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(journal->names, guiIconsName, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_MAX_NAME_LENGTH);
+
+    // Journal rewritten with recovered changes, invalid records discarded
+    if (!CompactIconsJournal(journal)) LOG("WARNING: Icons journal could not be written: %s\n", journal->fileName);
+
+    return replayed;
+}
+
+// Update icons journal, changed icons (data or name id) appended
+// NOTE: Records are flushed on every update, no full iconset rewrite required
+static int UpdateIconsJournal(IconsJournal *journal)
+{
+    int changes = 0;
+
+    if (journal->file == NULL) return changes;
+
+    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+    {
+        unsigned int *data = &currentIcons[i*RAYGUI_ICON_DATA_ELEMENTS];
+
+        if ((memcmp(data, &journal->icons[i*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0) ||
+            (strncmp(guiIconsName[i], journal->names[i], RAYGUI_ICON_MAX_NAME_LENGTH) != 0))
+        {
+            SetIconData(journal->icons, i, data);
+            memcpy(journal->names[i], guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH);
+
+            WriteIconsJournalRecord(journal, i);
+            changes++;
+        }
+    }
+
+    if (changes > 0)
+    {
+        if (journal->recordCount >= ICONS_JOURNAL_MAX_RECORDS) CompactIconsJournal(journal);
+        else fflush(journal->file);
+    }
+
+    return changes;
+}
+
+// Reset icons journal, iconset file saved: saved icons become journal base
+// NOTE: Only if saved file is the journaled iconset file, journaled changes not saved are kept
+static void ResetIconsJournal(IconsJournal *journal, const char *fileName, const unsigned int *icons, char names[][RAYGUI_ICON_MAX_NAME_LENGTH])
+{
+    if ((journal->iconsFileName[0] == '\0') || (strcmp(journal->iconsFileName, fileName) != 0)) return;
+
+    journal->baseChecksum = GetIconsFileChecksum(fileName);
+    memcpy(journal->baseIcons, icons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(journal->baseNames, names, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_MAX_NAME_LENGTH);
+
+    CompactIconsJournal(journal);
+}
+
+// Close icons journal, optionally removing journal file (changes saved or discarded)
+static void CloseIconsJournal(IconsJournal *journal, bool removeFile)
+{
+    if (journal->file != NULL) fclose(journal->file);
+    if (removeFile && (journal->fileName[0] != '\0')) remove(journal->fileName);
+
+    journal->file = NULL;
+    journal->fileName[0] = '\0';
+    journal->iconsFileName[0] = '\0';
+}
+
+// Compact icons journal, rewritten with one record per icon changed from iconset file
+// NOTE: Journal is written to a temporary file and renamed, previous journal is kept valid until then
+static bool CompactIconsJournal(IconsJournal *journal)
+{
+    bool success = false;
+    char tempFileName[512 + 16] = { 0 };
+    snprintf(tempFileName, sizeof(tempFileName), "%s.tmp", journal->fileName);
+
+    if (journal->file != NULL) fclose(journal->file);
+    journal->file = fopen(tempFileName, "wb");
+    journal->sequence = 0;
+    journal->recordCount = 0;
+
+    if (journal->file != NULL)
+    {
+        IconsJournalHeader header = { { 'r', 'G', 'I', 'J' }, 100, 0, journal->baseChecksum };
+        success = (fwrite(&header, sizeof(IconsJournalHeader), 1, journal->file) == 1);
+
+        for (int i = 0; (i < RAYGUI_ICON_MAX_ICONS) && success; i++)
+        {
+            if ((memcmp(&journal->icons[i*RAYGUI_ICON_DATA_ELEMENTS], &journal->baseIcons[i*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0) ||
+                (strncmp(journal->names[i], journal->baseNames[i], RAYGUI_ICON_MAX_NAME_LENGTH) != 0)) success = WriteIconsJournalRecord(journal, i);
+        }
+
+        success = (fclose(journal->file) == 0) && success;
+        journal->file = NULL;
+
+        if (success)
+        {
+        #if defined(_WIN32)
+            remove(journal->fileName);      // NOTE: rename() does not replace existing files on Windows
+        #endif
+            success = (rename(tempFileName, journal->fileName) == 0);
+        }
+        else remove(tempFileName);
+    }
+
+    if (success) journal->file = fopen(journal->fileName, "ab");
+
+    return (journal->file != NULL);
+}
+
+// Write icons journal record, journaled icon state (data and name id)
+static bool WriteIconsJournalRecord(IconsJournal *journal, int iconId)
+{
+    IconsJournalRecord record = { 0 };
+
+    record.sequence = ++journal->sequence;
+    record.iconId = (unsigned short)iconId;
+    memcpy(record.data, &journal->icons[iconId*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memcpy(record.name, journal->names[iconId], RAYGUI_ICON_MAX_NAME_LENGTH);
+    record.checksum = ComputeJournalChecksum(&record, sizeof(IconsJournalRecord) - sizeof(unsigned int));
+
+    journal->recordCount++;
+
+    return (fwrite(&record, sizeof(IconsJournalRecord), 1, journal->file) == 1);
+}
+
+// Get iconset file checksum, 0 if file can not be loaded
+static unsigned int GetIconsFileChecksum(const char *fileName)
+{
+    unsigned int checksum = 0;
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        checksum = ComputeJournalChecksum(fileData, dataSize);
+        UnloadFileData(fileData);
+    }
+
+    return checksum;
+}
+
+// Compute data checksum (FNV-1a, 32-bit)
+static unsigned int ComputeJournalChecksum(const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned int checksum = 2166136261u;
+
+    for (int i = 0; i < size; i++)
+    {
+        checksum ^= bytes[i];
+        checksum *= 16777619u;
+    }
+
+    return checksum;
+}
+#endif      // SUPPORT_ICONS_JOURNAL
+
+#if defined(SUPPORT_ICONS_AUTOSAVE)
+//--------------------------------------------------------------------------------------------
+// Icons autosave functions
+//--------------------------------------------------------------------------------------------
+
+// Icons autosave worker
+static void IconsAutosaveWorker(void *arg)
+{
+    iconsAutosave.saved = SaveIconsAutosaveSnapshot();
+}
+
+// Start iconset autosave, changed icons copied to snapshot
+// NOTE: Only icons changed since previous snapshot are copied, snapshot saved right now
+// in case worker thread can not be created
+static bool StartIconsAutosave(const char *fileName)
+{
+    if (iconsAutosave.running) return false;
+
+    if (strcmp(iconsAutosave.fileName, fileName) != 0)
+    {
+        snprintf(iconsAutosave.fileName, sizeof(iconsAutosave.fileName), "%s", fileName);
+        memcpy(iconsAutosave.icons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+        memcpy(iconsAutosave.names, guiIconsName, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_MAX_NAME_LENGTH);
+    }
+    else
+    {
+        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        {
+            if (memcmp(&iconsAutosave.icons[i*RAYGUI_ICON_DATA_ELEMENTS], &currentIcons[i*RAYGUI_ICON_DATA_ELEMENTS], RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
+                SetIconData(iconsAutosave.icons, i, &currentIcons[i*RAYGUI_ICON_DATA_ELEMENTS]);
+            if (strncmp(iconsAutosave.names[i], guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH) != 0)
+                memcpy(iconsAutosave.names[i], guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH);
+        }
+    }
+
+    iconsAutosave.time = GetTime();
+    iconsAutosave.saved = false;
+
+    bool threaded = StartWorkerThread(&iconsAutosave.worker, IconsAutosaveWorker, NULL);
+
+    if (!threaded) iconsAutosave.saved = SaveIconsAutosaveSnapshot();
+    iconsAutosave.running = true;
+
+    return threaded;
+}
+
+// Save iconset autosave snapshot, temporary file renamed
+// NOTE: Iconset file is never left partially written, no global state accessed but snapshot
+static bool SaveIconsAutosaveSnapshot(void)
+{
+    char tempFileName[512 + 8] = { 0 };
+    snprintf(tempFileName, sizeof(tempFileName), "%s.tmp", iconsAutosave.fileName);
+
+    bool saved = (SaveIconsData(tempFileName, iconsAutosave.icons, iconsAutosave.names) == 0);
+
+    if (saved)
+    {
+    #if defined(_WIN32)
+        remove(iconsAutosave.fileName);     // NOTE: rename() does not replace existing files on Windows
+    #endif
+        saved = (rename(tempFileName, iconsAutosave.fileName) == 0);
+    }
+
+    if (!saved) remove(tempFileName);
+
+    return saved;
+}
+
+// Check if iconset autosave worker thread finished (non blocking)
+static bool IsIconsAutosaveFinished(void)
+{
+    return IsWorkerThreadFinished(&iconsAutosave.worker);
+}
+
+// Join iconset autosave worker thread (blocking), returns true if snapshot saved
+static bool JoinIconsAutosave(void)
+{
+    if (!iconsAutosave.running) return false;
+
+    JoinWorkerThread(&iconsAutosave.worker);
+
+    iconsAutosave.running = false;
+
+    return iconsAutosave.saved;
+}
+
+// Check if iconset autosave snapshot matches current iconset
+static bool IsIconsAutosaveCurrent(void)
+{
+    bool current = (memcmp(iconsAutosave.icons, currentIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) == 0);
+
+    for (int i = 0; (i < RAYGUI_ICON_MAX_ICONS) && current; i++) current = (strncmp(iconsAutosave.names[i], guiIconsName[i], RAYGUI_ICON_MAX_NAME_LENGTH) == 0);
+
+    return current;
+}
+#endif      // SUPPORT_ICONS_AUTOSAVE
+
+//--------------------------------------------------------------------------------------------
+// Auxiliar functions
+//--------------------------------------------------------------------------------------------
+
+#if defined(SUPPORT_IDLE_EVENT_WAITING)
+// Check if any input event happened on current frame
+// NOTE: Keys state is checked directly, keys/chars queues are not consumed (required by raygui)
+static bool IsInputEventDetected(void)
+{
+    bool detected = IsFileDropped() || (GetMouseWheelMove() != 0.0f);
+
+    Vector2 mouseDelta = GetMouseDelta();
+    if ((mouseDelta.x != 0.0f) || (mouseDelta.y != 0.0f)) detected = true;
+
+    for (int button = MOUSE_BUTTON_LEFT; !detected && (button <= MOUSE_BUTTON_BACK); button++)
+    {
+        if (IsMouseButtonDown(button) || IsMouseButtonReleased(button)) detected = true;
+    }
+
+    for (int key = KEY_SPACE; !detected && (key <= KEY_KB_MENU); key++)
+    {
+        if (IsKeyDown(key) || IsKeyReleased(key)) detected = true;
+    }
+
+    return detected;
+}
+#endif
+
+#if !defined(RGUIICONS_CLI_ONLY)
+// Converts an image to bits array following: Alpha->0, NoAlpha->1
+// Very useful to store 1bit color images in an efficient (and quite secure) way
+// NOTE: Image size MUST be multiple of 8 for correct fit
+static unsigned char *ImageToBits(Image image)
+{
+    Color *pixels = LoadImageColors(image);
+
+    // Calculate number of bytes required
+    int size = image.width*image.height/8;
+
+    unsigned char *bytes = (unsigned char *)calloc(size, sizeof(unsigned char));
+
+    for (int i = 0; i < size; i++)
+    {
+        for (int k = 0; k < 8; k++)
+        {
+            if (ColorToInt(pixels[i]) >= 0x000000ff) RGI_BIT_SET(bytes[i + k], k);
+        }
+    }
+
+    UnloadImageColors(pixels);
+
+    return bytes;
+}
+
+// Generate color-alpha image from and array of bits, stored in bytes
+// NOTE: 0-BLANK, 1-color
+static Image GenImageFromBits(unsigned char *bytes, int width, int height, Color color)
+{
+    Image image = { 0 };
+
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    image.data = (Color *)calloc(image.width*image.height, sizeof(Color));
+
+    for (int i = 0; i < width*height/8; i++)
+    {
+        for (int k = 0; k < 8; k++)
+        {
+            if (RGI_BIT_CHECK(bytes[i], k)) ((Color *)image.data)[i + k] = color;
+        }
+    }
+
+    return image;
+}
+
+// Gen icon pixels mask for shape tool (line, rectangle, ellipse), shape defined by two cells
+static void GenIconShapeMask(unsigned int *mask, int tool, int x0, int y0, int x1, int y1)
+{
+    memset(mask, 0, RAYGUI_ICON_SIZE*sizeof(unsigned int));
+
+    switch (tool)
+    {
+        case EDIT_TOOL_LINE:
+        {
+            // Bresenham line, all octants
+            int dx = abs(x1 - x0), sx = (x0 < x1)? 1 : -1;
+            int dy = -abs(y1 - y0), sy = (y0 < y1)? 1 : -1;
+            int error = dx + dy;
+
+            while (true)
+            {
+                SetMaskPixel(mask, x0, y0);
+                if ((x0 == x1) && (y0 == y1)) break;
+
+                int error2 = 2*error;
+                if (error2 >= dy) { error += dy; x0 += sx; }
+                if (error2 <= dx) { error += dx; y0 += sy; }
+            }
+        } break;
+        case EDIT_TOOL_RECTANGLE:
+        {
+            if (x0 > x1) { int temp = x0; x0 = x1; x1 = temp; }
+            if (y0 > y1) { int temp = y0; y0 = y1; y1 = temp; }
+
+            // Top and bottom rows filled as one span, middle rows only borders
+            unsigned int span = (ICON_ROW_BITS >> (RAYGUI_ICON_SIZE - 1 - x1)) & ~((1u << x0) - 1);
+            unsigned int borders = (1u << x0) | (1u << x1);
+
+            for (int y = y0; y <= y1; y++) mask[y] = ((y == y0) || (y == y1))? span : borders;
+        } break;
+        case EDIT_TOOL_ELLIPSE:
+        {
+            // Midpoint ellipse inscribed in rectangle, integer only
+            // REF: A Rasterizing Algorithm for Drawing Curves, Alois Zingl (2012)
+            int a = abs(x1 - x0), b = abs(y1 - y0), b1 = b & 1;
+            long dx = 4*(1 - a)*b*b, dy = 4*(b1 + 1)*a*a;
+            long error = dx + dy + b1*a*a;
+
+            if (x0 > x1) { x0 = x1; x1 += a; }
+            if (y0 > y1) y0 = y1;
+            y0 += (b + 1)/2;
+            y1 = y0 - b1;
+
+            long a8 = 8*a*a, b8 = 8*b*b;
+
+            do
+            {
+                SetMaskPixel(mask, x1, y0);
+                SetMaskPixel(mask, x0, y0);
+                SetMaskPixel(mask, x0, y1);
+                SetMaskPixel(mask, x1, y1);
+
+                long error2 = 2*error;
+                if (error2 <= dy) { y0++; y1--; dy += a8; error += dy; }
+                if ((error2 >= dx) || (2*error > dy)) { x0++; x1--; dx += b8; error += dx; }
+
+            } while (x0 <= x1);
+
+            // Flat ellipses: finish ellipse tips
+            while ((y0 - y1) < b)
+            {
+                SetMaskPixel(mask, x0 - 1, y0);
+                SetMaskPixel(mask, x1 + 1, y0++);
+                SetMaskPixel(mask, x0 - 1, y1);
+                SetMaskPixel(mask, x1 + 1, y1--);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Gen icon pixels mask for flood fill: pixels 4-connected to provided pixel, with same value
+// NOTE: Scanline fill over row masks, every row grown horizontally inside its fillable pixels
+// and propagated to upper and lower rows, until no row changes (bit-parallel, no per-pixel search)
+static void GenIconFillMask(unsigned int *mask, const unsigned int *data, int x, int y)
+{
+    unsigned int fillable[RAYGUI_ICON_SIZE] = { 0 };
+    bool set = RGI_BIT_CHECK(data[y/ICON_ROWS_PER_ELEMENT], x + (y%ICON_ROWS_PER_ELEMENT)*RAYGUI_ICON_SIZE);
+
+    memset(mask, 0, RAYGUI_ICON_SIZE*sizeof(unsigned int));
+
+    for (int row = 0; row < RAYGUI_ICON_SIZE; row++)
+    {
+        unsigned int bits = (data[row/ICON_ROWS_PER_ELEMENT] >> ((row%ICON_ROWS_PER_ELEMENT)*RAYGUI_ICON_SIZE)) & ICON_ROW_BITS;
+        fillable[row] = set? bits : (~bits & ICON_ROW_BITS);
+    }
+
+    mask[y] = (1u << x);
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+
+        // Alternate down and up sweeps, most shapes filled in one or two sweeps
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int i = 0; i < RAYGUI_ICON_SIZE; i++)
+            {
+                int row = (pass == 0)? i : (RAYGUI_ICON_SIZE - 1 - i);
+                unsigned int bits = mask[row];
+
+                if (row > 0) bits |= mask[row - 1];
+                if (row < (RAYGUI_ICON_SIZE - 1)) bits |= mask[row + 1];
+                bits &= fillable[row];
+
+                // Grow horizontally inside fillable spans
+                unsigned int prevBits = 0;
+                while (bits != prevBits) { prevBits = bits; bits |= ((bits << 1) | (bits >> 1)) & fillable[row]; }
+
+                if (bits != mask[row]) { mask[row] = bits; changed = true; }
+            }
+        }
+    }
+}
+
+// Set or clear icon data masked pixels, one data element (multiple rows) per operation
+static void ApplyIconMask(unsigned int *data, const unsigned int *mask, bool set)
+{
+    for (int i = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++)
+    {
+        unsigned int elementMask = 0;
+        for (int k = 0; k < ICON_ROWS_PER_ELEMENT; k++) elementMask |= (mask[i*ICON_ROWS_PER_ELEMENT + k] << (k*RAYGUI_ICON_SIZE));
+
+        if (set) data[i] |= elementMask;
+        else data[i] &= ~elementMask;
+    }
+}
+
+// Set icon pixels mask pixel, out of icon pixels ignored
+static void SetMaskPixel(unsigned int *mask, int x, int y)
+{
+    if ((x >= 0) && (x < RAYGUI_ICON_SIZE) && (y >= 0) && (y < RAYGUI_ICON_SIZE)) mask[y] |= (1u << x);
+}
+#endif  // !RGUIICONS_CLI_ONLY
+
+// Get icon content hash (64-bit), 0 for empty icons
+// NOTE: Icon words are mixed two by two (multiply-xorshift), final avalanche from MurmurHash3 fmix64
+static unsigned long long HashIconData(const unsigned int *data)
+{
+    unsigned long long hash = 0x9e3779b97f4a7c15ULL;
+    unsigned int bits = 0;
+
+    for (int i = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i += 2)
+    {
+        unsigned long long value = ((unsigned long long)data[i + 1] << 32) | data[i];
+        bits |= (data[i] | data[i + 1]);
+
+        hash ^= value*0x87c37b91114253d5ULL;
+        hash = ((hash << 31) | (hash >> 33))*0x4cf5ad432745937fULL;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    // NOTE: Empty icons get a reserved hash, never considered duplicates
+    if (bits == 0) hash = 0;
+    else if (hash == 0) hash = 1;
+
+    return hash;
+}
+
+// Get icons distance: different pixels count (XOR + popcount over icon words)
+static int GetIconsDistance(const unsigned int *icon1, const unsigned int *icon2)
+{
+    int distance = 0;
+
+    for (int i = 0; i < RAYGUI_ICON_DATA_ELEMENTS; i++) distance += ICON_POPCOUNT(icon1[i] ^ icon2[i]);
+
+    return distance;
+}
+
+#if !defined(__GNUC__) && !defined(__clang__) && !defined(_MSC_VER)
+// Get set bits count (portable, SWAR)
+static int PopCount(unsigned int value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+
+    return (int)((((value + (value >> 4)) & 0x0f0f0f0f)*0x01010101) >> 24);
+}
+#endif
+
+// Load icons BK-tree for similarity search
+// NOTE: Icons data is not copied, it must be kept available while tree is used
+static IconsTree LoadIconsTree(const unsigned int *icons, int count)
+{
+    IconsTree tree = { 0 };
+
+    tree.icons = icons;
+    tree.nodes = (IconsTreeNode *)RL_CALLOC(count, sizeof(IconsTreeNode));
+
+    for (int i = 0; (tree.nodes != NULL) && (i < count); i++)
+    {
+        const unsigned int *icon = icons + i*RAYGUI_ICON_DATA_ELEMENTS;
+        if (HashIconData(icon) == 0) continue;      // Empty icons not added
+
+        IconsTreeNode *node = &tree.nodes[tree.nodeCount];
+        node->entry = i;
+        node->firstChild = -1;
+        node->nextSibling = -1;
+
+        // Find parent node: descend by the child at same distance than new icon
+        int current = 0;
+        while (tree.nodeCount > 0)
+        {
+            int distance = GetIconsDistance(icon, icons + tree.nodes[current].entry*RAYGUI_ICON_DATA_ELEMENTS);
+            int child = tree.nodes[current].firstChild;
+
+            while ((child != -1) && (tree.nodes[child].distance != distance)) child = tree.nodes[child].nextSibling;
+
+            if (child == -1)
+            {
+                node->distance = distance;
+                node->nextSibling = tree.nodes[current].firstChild;
+                tree.nodes[current].firstChild = tree.nodeCount;
+                break;
+            }
+            else current = child;
+        }
+
+        tree.nodeCount++;
+    }
+
+    return tree;
+}
+
+// Unload icons BK-tree
+static void UnloadIconsTree(IconsTree tree)
+{
+    RL_FREE(tree.nodes);
+}
+
+// Search most similar icons in tree (k nearest), results sorted by distance
+// NOTE: Subtrees pruned by triangle inequality, search radius shrinks as better matches are found
+static int SearchIconsTree(IconsTree tree, const unsigned int *icon, int excludeEntry, IconMatch *matches, int maxMatches)
+{
+    int matchCount = 0;
+    if ((tree.nodeCount == 0) || (maxMatches <= 0)) return 0;
+
+    // Nodes pending to visit and their min possible distance to searched icon
+    int *stack = (int *)RL_CALLOC(tree.nodeCount*2, sizeof(int));
+    int stackSize = 0;
+
+    stack[0] = 0;
+    stack[1] = 0;
+    stackSize = 1;
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+        int current = stack[stackSize*2];
+        int minDistance = stack[stackSize*2 + 1];
+
+        int radius = (matchCount < maxMatches)? RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE : matches[matchCount - 1].distance;
+        if (minDistance > radius) continue;
+
+        IconsTreeNode *node = &tree.nodes[current];
+        int distance = GetIconsDistance(icon, tree.icons + node->entry*RAYGUI_ICON_DATA_ELEMENTS);
+
+        // Insert match sorted by distance (insertion sort, few matches)
+        if ((node->entry != excludeEntry) && ((matchCount < maxMatches) || (distance < radius)))
+        {
+            int position = (matchCount < maxMatches)? matchCount++ : (maxMatches - 1);
+            while ((position > 0) && (matches[position - 1].distance > distance))
+            {
+                matches[position] = matches[position - 1];
+                position--;
+            }
+
+            matches[position] = (IconMatch){ node->entry, distance };
+            radius = (matchCount < maxMatches)? RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE : matches[matchCount - 1].distance;
+        }
+
+        // Visit children that could contain icons within radius: |child.distance - distance| <= radius
+        for (int child = node->firstChild; child != -1; child = tree.nodes[child].nextSibling)
+        {
+            int childMinDistance = abs(tree.nodes[child].distance - distance);
+
+            if (childMinDistance <= radius)
+            {
+                stack[stackSize*2] = child;
+                stack[stackSize*2 + 1] = childMinDistance;
+                stackSize++;
+            }
+        }
+    }
+
+    RL_FREE(stack);
+
+    return matchCount;
+}
+
+// Update icons name ids index, only name ids changed since last update are indexed again
+// NOTE: Changed name id removed from its hash bucket and words list and inserted again, O(n) per change,
+// name ids from count position are considered unnamed (not indexed)
+static int UpdateIconsNameIndex(IconsNameIndex *index, char names[][RAYGUI_ICON_MAX_NAME_LENGTH], int count)
+{
+    static const char unnamed[RAYGUI_ICON_MAX_NAME_LENGTH] = { 0 };
+    int changedCount = 0;
+
+    if (!index->initialized)
+    {
+        memset(index->indexedNames, 0, sizeof(index->indexedNames));
+        for (int i = 0; i < ICONS_NAME_INDEX_BUCKETS; i++) index->buckets[i] = -1;
+        index->wordCount = 0;
+        index->initialized = true;
+    }
+
+    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+    {
+        const char *name = (i < count)? names[i] : unnamed;
+
+        if (strncmp(index->indexedNames[i], name, RAYGUI_ICON_MAX_NAME_LENGTH - 1) == 0) continue;
+
+        // Remove previous name id: hash bucket and words
+        if (index->indexedNames[i][0] != '\0')
+        {
+            int *link = &index->buckets[index->hashes[i] & (ICONS_NAME_INDEX_BUCKETS - 1)];
+            while (*link != i) link = &index->nextInBucket[*link];
+            *link = index->nextInBucket[i];
+
+            int wordCount = 0;
+            for (int w = 0; w < index->wordCount; w++) if (index->words[w].iconId != i) index->words[wordCount++] = index->words[w];
+            index->wordCount = wordCount;
+        }
+
+        memcpy(index->indexedNames[i], name, RAYGUI_ICON_MAX_NAME_LENGTH);
+        index->indexedNames[i][RAYGUI_ICON_MAX_NAME_LENGTH - 1] = '\0';
+        changedCount++;
+
+        // Insert new name id: hash bucket and words (sorted position found by binary search)
+        if (index->indexedNames[i][0] != '\0')
+        {
+            index->hashes[i] = HashIconName(index->indexedNames[i]);
+
+            int bucket = index->hashes[i] & (ICONS_NAME_INDEX_BUCKETS - 1);
+            index->nextInBucket[i] = index->buckets[bucket];
+            index->buckets[bucket] = i;
+
+            for (int offset = 0; index->indexedNames[i][offset] != '\0'; offset++)
+            {
+                if ((offset > 0) && (index->indexedNames[i][offset - 1] != '_')) continue;
+                if ((index->indexedNames[i][offset] == '_') || (index->wordCount >= ICONS_NAME_INDEX_MAX_WORDS)) continue;
+
+                int low = 0;
+                int high = index->wordCount;
+
+                while (low < high)
+                {
+                    int middle = (low + high)/2;
+                    IconNameWord *word = &index->words[middle];
+
+                    if (CompareIconNames(index->indexedNames[word->iconId] + word->offset, index->indexedNames[i] + offset, false) < 0) low = middle + 1;
+                    else high = middle;
+                }
+
+                memmove(&index->words[low + 1], &index->words[low], (index->wordCount - low)*sizeof(IconNameWord));
+                index->words[low] = (IconNameWord){ (short)i, (short)offset };
+                index->wordCount++;
+            }
+        }
+    }
+
+    return changedCount;
+}
+
+// Find icon by name id (case-insensitive), optional "ICON_" prefix (exported code naming) ignored
+// NOTE: If several icons share the name id, first icon is returned
+static int FindIconByName(const IconsNameIndex *index, const char *name)
+{
+    int iconId = -1;
+
+    if (CompareIconNames("ICON_", name, true) == 0) name += 5;
+    if ((name[0] == '\0') || !index->initialized) return -1;
+
+    unsigned int hash = HashIconName(name);
+
+    for (int i = index->buckets[hash & (ICONS_NAME_INDEX_BUCKETS - 1)]; i != -1; i = index->nextInBucket[i])
+    {
+        if ((index->hashes[i] == hash) && (CompareIconNames(index->indexedNames[i], name, false) == 0) &&
+            ((iconId == -1) || (i < iconId))) iconId = i;
+    }
+
+    return iconId;
+}
+
+// Filter icons with a name id word starting with text (case-insensitive), i.e. "SAVE" matches "FILE_SAVE"
+// NOTE: Matching words are contiguous on sorted words list, first one found by binary search
+static int FilterIconsByName(const IconsNameIndex *index, const char *text, bool *matches)
+{
+    int matchCount = 0;
+
+    memset(matches, 0, RAYGUI_ICON_MAX_ICONS*sizeof(bool));
+
+    if (CompareIconNames("ICON_", text, true) == 0) text += 5;
+    if ((text[0] == '\0') || !index->initialized) return 0;
+
+    int low = 0;
+    int high = index->wordCount;
+
+    while (low < high)
+    {
+        int middle = (low + high)/2;
+        const IconNameWord *word = &index->words[middle];
+
+        if (CompareIconNames(index->indexedNames[word->iconId] + word->offset, text, false) < 0) low = middle + 1;
+        else high = middle;
+    }
+
+    for (int w = low; w < index->wordCount; w++)
+    {
+        const IconNameWord *word = &index->words[w];
+        if (CompareIconNames(text, index->indexedNames[word->iconId] + word->offset, true) != 0) break;
+
+        if (!matches[word->iconId]) { matches[word->iconId] = true; matchCount++; }
+    }
+
+    return matchCount;
+}
+
+// Get icon name id hash (case-insensitive), FNV-1a
+static unsigned int HashIconName(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; name[i] != '\0'; i++)
+    {
+        hash ^= (unsigned char)toupper((unsigned char)name[i]);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Compare icon name ids (case-insensitive), if prefix requested only name1 length is compared
+static int CompareIconNames(const char *name1, const char *name2, bool prefix)
+{
+    int i = 0;
+
+    for (; name1[i] != '\0'; i++)
+    {
+        int difference = toupper((unsigned char)name1[i]) - toupper((unsigned char)name2[i]);
+        if (difference != 0) return difference;
+    }
+
+    return prefix? 0 : -(int)(unsigned char)name2[i];
+}
+
+#if !defined(RGUIICONS_CLI_ONLY)
+// Update icons content index, only icons changed since last update are hashed again
+// NOTE: Duplicates are resolved with an open addressing table (hash confirmed by data),
+// only required when some icon changed
+static void UpdateIconsIndex(IconsIndex *index, const unsigned int *iconset)
+{
+    bool changed = false;
+
+    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+    {
+        const unsigned int *data = iconset + i*RAYGUI_ICON_DATA_ELEMENTS;
+        unsigned int *indexedData = index->indexedIcons + i*RAYGUI_ICON_DATA_ELEMENTS;
+
+        if (!index->initialized || (memcmp(indexedData, data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0))
+        {
+            memcpy(indexedData, data, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            index->hashes[i] = HashIconData(data);
+            changed = true;
+        }
+    }
+
+    index->initialized = true;
+
+    if (changed)
+    {
+        int table[RAYGUI_ICON_MAX_ICONS*2];     // Icons ids table, load factor 0.5
+        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS*2; i++) table[i] = -1;
+
+        index->duplicateCount = 0;
+
+        for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+        {
+            index->duplicateOf[i] = -1;
+            if (index->hashes[i] == 0) continue;
+
+            int slot = (int)(index->hashes[i]%(RAYGUI_ICON_MAX_ICONS*2));
+
+            while (table[slot] != -1)
+            {
+                int id = table[slot];
+
+                if ((index->hashes[id] == index->hashes[i]) &&
+                    (memcmp(index->indexedIcons + id*RAYGUI_ICON_DATA_ELEMENTS, index->indexedIcons + i*RAYGUI_ICON_DATA_ELEMENTS, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) == 0))
+                {
+                    index->duplicateOf[i] = id;
+                    index->duplicateCount++;
+                    break;
+                }
+
+                slot = (slot + 1)%(RAYGUI_ICON_MAX_ICONS*2);
+            }
+
+            if (index->duplicateOf[i] == -1) table[slot] = i;
+        }
+    }
+}
+#endif
@@ -0,0 +1,366 @@
+/*******************************************************************************************
+*
+*   rGuiIcons benchmark - Headless benchmark for iconset load/save/export/render kernels
+*
+*   DESCRIPTION:
+*       Iconset functions from rGuiIcons, raygui and rpng are measured against a synthetic
+*       iconset of configurable icons count and pixels density, no window is created
+*
+*       Benchmarks:
+*           save_rgi        - SaveIcons(): Save iconset file (.rgi)
+*           load_rgi        - GuiLoadIcons(): Load iconset file (.rgi) with name ids
+*           export_code     - ExportIconsAsCode(): Export iconset as code (.h)
+*           gen_image       - GenImageFromIconData(): Gen iconset image (grayscale)
+*           export_image    - GenImageFromIconData() + ExportImage(): Export iconset image (.png, raylib)
+*           export_png      - ExportIconsAsImage(): Export iconset 1-bit image (.png, rpng, zTXt name ids)
+*           load_png        - LoadIconsFromImage(): Load iconset from image (.png)
+*           draw_icon       - DrawIcon(): Draw all icons at edit scale (x16)
+*           draw_gui_icon   - GuiDrawIcon(): Draw all icons at toggle group scale (x1)
+*
+*       Results are reported on stdout as CSV, one line per benchmark:
+*           benchmark,iterations,total_ms,us_per_op,ops_per_sec,mb_per_sec,allocs_per_op,alloc_bytes_per_op,rects_per_op
+*
+*   USAGE:
+*       > rguiicons_bench [--icons <count>] [--density <percent>] [--iterations <count>] [--seed <value>] [--path <directory>]
+*
+*   ADDITIONAL NOTES:
+*       Draw functions are redirected to a sink, icon drawing loops are measured without GPU
+*       Allocations are counted redirecting malloc()/calloc()/realloc() for rGuiIcons, raygui
+*       and rpng code, allocations internal to raylib library are not counted
+*       Files are written to provided path (current directory by default) and deleted on finish
+*
+*   BUILDING:
+*     - Linux (GCC):
+*       make bench RAYLIB_PATH=<path_to_raylib>
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019-2025 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free(), atoi()
+#include <stdio.h>                  // Required for: printf(), fopen(), ftell(), remove()
+#include <string.h>                 // Required for: strcmp(), strcpy(), memset()
+#include <time.h>                   // Required for: clock_gettime(), clock()
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Allocations tracking
+// NOTE: Defined before including raygui, rpng and iconset, allocations are redirected
+//----------------------------------------------------------------------------------
+static unsigned int benchAllocs = 0;        // Allocations counter (malloc, calloc, realloc)
+static size_t benchAllocBytes = 0;          // Allocations requested size counter
+
+static void *BenchMalloc(size_t size) { benchAllocs++; benchAllocBytes += size; return malloc(size); }
+static void *BenchCalloc(size_t count, size_t size) { benchAllocs++; benchAllocBytes += count*size; return calloc(count, size); }
+static void *BenchRealloc(void *ptr, size_t size) { benchAllocs++; benchAllocBytes += size; return realloc(ptr, size); }
+
+#define malloc(size)            BenchMalloc(size)
+#define calloc(count, size)     BenchCalloc(count, size)
+#define realloc(ptr, size)      BenchRealloc(ptr, size)
+
+//----------------------------------------------------------------------------------
+// Draw sink
+// NOTE: Rectangles are counted and consumed, icon drawing loops are not optimized out
+//----------------------------------------------------------------------------------
+static unsigned int benchRectangles = 0;    // Rectangles drawn counter
+static unsigned int benchChecksum = 0;      // Rectangles data checksum
+
+static void BenchDrawRectangle(int posX, int posY, int width, int height, Color color)
+{
+    benchRectangles++;
+    benchChecksum += (unsigned int)(posX + posY*31 + width + height + color.a);
+}
+
+#define DrawRectangle(posX, posY, width, height, color)     BenchDrawRectangle(posX, posY, width, height, color)
+
+#define RAYGUI_IMPLEMENTATION
+#include "raygui.h"                         // Required for: GuiLoadIcons(), GuiDrawIcon()
+
+#define RPNG_IMPLEMENTATION
+#include "external/rpng.h"                  // PNG chunks management
+
+#define ICONSET_IMPLEMENTATION
+#include "iconset.h"                        // rGuiIcons iconset data load/save/export
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static double benchStartTime = 0.0;         // Current benchmark start time
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetBenchTime(void);                           // Get monotonic time in seconds
+static long GetBenchFileSize(const char *fileName);         // Get file size in bytes
+static void GenIconsetSynthetic(int iconCount, int density, unsigned int seed); // Gen synthetic iconset over current iconset
+static Image GenImageFromIconData(unsigned int *icons, int iconCount, int iconsPerLine, int padding); // Gen icons pack image from icon data array
+static void BenchBegin(void);                               // Begin benchmark, counters reset
+static void BenchEnd(const char *name, int iterations, double bytesPerOp);  // End benchmark, results reported
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
+
+    int iconCount = RAYGUI_ICON_MAX_ICONS;
+    int density = 50;
+    int iterations = 100;
+    unsigned int seed = 1;
+    char path[512] = ".";
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--icons") == 0) && ((i + 1) < argc)) iconCount = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--density") == 0) && ((i + 1) < argc)) density = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--iterations") == 0) && ((i + 1) < argc)) iterations = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--seed") == 0) && ((i + 1) < argc)) seed = (unsigned int)atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--path") == 0) && ((i + 1) < argc)) strcpy(path, argv[++i]);
+        else
+        {
+            printf("USAGE: rguiicons_bench [--icons <count>] [--density <percent>] [--iterations <count>] [--seed <value>] [--path <directory>]\n");
+            return 1;
+        }
+    }
+
+    if (iconCount < 1) iconCount = 1;
+    else if (iconCount > RAYGUI_ICON_MAX_ICONS) iconCount = RAYGUI_ICON_MAX_ICONS;
+    if (density < 0) density = 0;
+    else if (density > 100) density = 100;
+    if (iterations < 1) iterations = 1;
+
+    char rgiFileName[512] = { 0 };
+    char codeFileName[512] = { 0 };
+    char imageFileName[512] = { 0 };
+    char pngFileName[512] = { 0 };
+    strcpy(rgiFileName, TextFormat("%s/rguiicons_bench.rgi", path));
+    strcpy(codeFileName, TextFormat("%s/rguiicons_bench.h", path));
+    strcpy(imageFileName, TextFormat("%s/rguiicons_bench_image.png", path));
+    strcpy(pngFileName, TextFormat("%s/rguiicons_bench.png", path));
+
+    GenIconsetSynthetic(iconCount, density, seed);
+
+    // Icons data processed by drawing benchmarks
+    const double iconsDataSize = (double)iconCount*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int);
+
+    printf("# icons=%i density=%i iterations=%i seed=%u\n", iconCount, density, iterations, seed);
+    printf("benchmark,iterations,total_ms,us_per_op,ops_per_sec,mb_per_sec,allocs_per_op,alloc_bytes_per_op,rects_per_op\n");
+
+    // Benchmark: save_rgi
+    SaveIcons(rgiFileName);     // Warm up
+    BenchBegin();
+    for (int i = 0; i < iterations; i++) SaveIcons(rgiFileName);
+    BenchEnd("save_rgi", iterations, (double)GetBenchFileSize(rgiFileName));
+
+    // Benchmark: load_rgi
+    // NOTE: Icons are loaded over raygui internal iconset, name ids freed as tool does
+    BenchBegin();
+    for (int i = 0; i < iterations; i++)
+    {
+        char **tempIconsName = GuiLoadIcons(rgiFileName, true);
+        for (int n = 0; (tempIconsName != NULL) && (n < RAYGUI_ICON_MAX_ICONS); n++) free(tempIconsName[n]);
+        free(tempIconsName);
+    }
+    BenchEnd("load_rgi", iterations, (double)GetBenchFileSize(rgiFileName));
+
+    // Benchmark: export_code
+    BenchBegin();
+    for (int i = 0; i < iterations; i++) ExportIconsAsCode(codeFileName);
+    BenchEnd("export_code", iterations, (double)GetBenchFileSize(codeFileName));
+
+    // Benchmark: gen_image
+    BenchBegin();
+    for (int i = 0; i < iterations; i++)
+    {
+        Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
+        UnloadImage(image);
+    }
+    BenchEnd("gen_image", iterations, iconsDataSize);
+
+    // Benchmark: export_image
+    BenchBegin();
+    for (int i = 0; i < iterations; i++)
+    {
+        Image image = GenImageFromIconData(currentIcons, RAYGUI_ICON_MAX_ICONS, 16, 1);
+        ExportImage(image, imageFileName);
+        UnloadImage(image);
+    }
+    BenchEnd("export_image", iterations, (double)GetBenchFileSize(imageFileName));
+
+    // Benchmark: export_png
+    BenchBegin();
+    for (int i = 0; i < iterations; i++) ExportIconsAsImage(pngFileName, true);
+    BenchEnd("export_png", iterations, (double)GetBenchFileSize(pngFileName));
+
+    // Benchmark: load_png
+    // NOTE: Icons and name ids are loaded over current iconset (same data, exported previously)
+    BenchBegin();
+    for (int i = 0; i < iterations; i++) LoadIconsFromImage(pngFileName, 16, 1);
+    BenchEnd("load_png", iterations, (double)GetBenchFileSize(pngFileName));
+
+    // Benchmark: draw_icon
+    BenchBegin();
+    for (int i = 0; i < iterations; i++)
+    {
+        for (int n = 0; n < iconCount; n++) DrawIcon(currentIcons, n, 0, 0, 16, BLACK);
+    }
+    BenchEnd("draw_icon", iterations, iconsDataSize);
+
+    // Benchmark: draw_gui_icon
+    // NOTE: raygui icons pointer is set to current iconset, as tool does for toggle group
+    guiIconsPtr = currentIcons;
+    BenchBegin();
+    for (int i = 0; i < iterations; i++)
+    {
+        for (int n = 0; n < iconCount; n++) GuiDrawIcon(n, 0, 0, 1, BLACK);
+    }
+    BenchEnd("draw_gui_icon", iterations, iconsDataSize);
+    guiIconsPtr = guiIcons;
+
+    printf("# checksum=%u\n", benchChecksum);
+
+    remove(rgiFileName);
+    remove(codeFileName);
+    remove(imageFileName);
+    remove(pngFileName);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get monotonic time in seconds
+static double GetBenchTime(void)
+{
+#if defined(_WIN32)
+    return (double)clock()/CLOCKS_PER_SEC;
+#else
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+#endif
+}
+
+// Get file size in bytes
+static long GetBenchFileSize(const char *fileName)
+{
+    long size = 0;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fclose(file);
+    }
+
+    return size;
+}
+
+// Gen synthetic iconset over current iconset
+// NOTE: Pixels set with density probability (percent), icons over count are cleared
+static void GenIconsetSynthetic(int iconCount, int density, unsigned int seed)
+{
+    unsigned int state = (seed != 0)? seed : 1;
+
+    memset(currentIcons, 0, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    memset(guiIconsName, 0, sizeof(guiIconsName));
+
+    for (int n = 0; n < iconCount; n++)
+    {
+        for (int i = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE; i++)
+        {
+            // Xorshift32 pseudo-random generator
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            if ((int)(state%100) < density) SetIconPixel(currentIcons, n, i%RAYGUI_ICON_SIZE, i/RAYGUI_ICON_SIZE);
+        }
+
+        strcpy(guiIconsName[n], TextFormat("ICON_%03i", n));
+    }
+}
+
+// Gen GRAYSCALE image from and array of bits stored as int (0-BLANK, 1-WHITE)
+// NOTE: Reference for raylib image export path, rGuiIcons exports 1-bit image directly
+static Image GenImageFromIconData(unsigned int *icons, int iconCount, int iconsPerLine, int padding)
+{
+    //#define RGI_BIT_CHECK(a,b) ((a) & (1<<(b)))
+
+    Image image = { 0 };
+
+    int lines = iconCount/iconsPerLine;
+    if (iconCount%iconsPerLine > 0) lines++;
+
+    image.width = (RAYGUI_ICON_SIZE + 2*padding)*iconsPerLine;
+    image.height = (RAYGUI_ICON_SIZE + 2*padding)*lines;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    image.data = (unsigned char *)calloc(image.width*image.height, 1);  // All pixels BLACK by default
+
+    int pixelX = 0;
+    int pixelY = 0;
+
+    for (int n = 0; n < iconCount; n++)
+    {
+        for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+        {
+            for (int k = 0; k < 32; k++)
+            {
+                pixelX = padding + (n%iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + (k%RAYGUI_ICON_SIZE);
+                pixelY = padding + (n/iconsPerLine)*(RAYGUI_ICON_SIZE + 2*padding) + y;
+
+                if (RGI_BIT_CHECK(icons[n*RAYGUI_ICON_DATA_ELEMENTS + i], k)) ((unsigned char *)image.data)[pixelY*image.width + pixelX] = 0xff;    // Draw pixel WHITE
+
+                if ((k == (RAYGUI_ICON_SIZE - 1)) || (k == 31)) y++;  // Move to next pixels line
+            }
+        }
+    }
+
+    return image;
+}
+
+// Begin benchmark, counters reset
+static void BenchBegin(void)
+{
+    benchAllocs = 0;
+    benchAllocBytes = 0;
+    benchRectangles = 0;
+
+    benchStartTime = GetBenchTime();
+}
+
+// End benchmark, results reported
+static void BenchEnd(const char *name, int iterations, double bytesPerOp)
+{
+    double totalTime = GetBenchTime() - benchStartTime;
+    if (totalTime <= 0.0) totalTime = 1e-9;
+
+    printf("%s,%i,%.3f,%.3f,%.1f,%.2f,%.1f,%.1f,%.1f\n", name, iterations, totalTime*1000.0,
+        totalTime*1e6/iterations, iterations/totalTime, bytesPerOp*iterations/(totalTime*1024.0*1024.0),
+        (double)benchAllocs/iterations, (double)benchAllocBytes/iterations, (double)benchRectangles/iterations);
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+#   rGuiIcons - Command-line converters training workload
+#
+#   Runs the iconset conversion paths (.rgi load/save, .png export/import, .h export)
+#   over the bundled corpus, used to collect execution profiles for PGO/BOLT builds
+#
+#   USAGE: train.sh <rguiicons-cli> [iterations]
+#
+#   Corpus (training/*.rgi):
+#       icons_default.rgi   - raygui default iconset, all icons and name ids defined
+#       icons_partial.rgi   - first 32 default icons only, rest empty and unnamed
+#       icons_design.rgi    - iconset imported from old design sheet (design/ricons.png)
+#
+#   LICENSE: zlib/libpng
+#
+#   Copyright (c) 2019-2025 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+#
+
+CLI="$1"
+ITERATIONS="${2:-20}"
+CORPUS_PATH="$(dirname "$0")"
+
+if [ -z "$CLI" ] || [ ! -x "$CLI" ]; then
+    echo "USAGE: $0 <rguiicons-cli> [iterations]"
+    exit 1
+fi
+
+OUTPUT_PATH="$(mktemp -d)"
+trap 'rm -rf "$OUTPUT_PATH"' EXIT
+
+i=0
+while [ "$i" -lt "$ITERATIONS" ]; do
+    for file in "$CORPUS_PATH"/*.rgi; do
+        name="$(basename "$file" .rgi)"
+
+        # Same conversions requested by batch pipelines: .rgi -> .png/.h/.rgi (loaded once), .png -> .rgi
+        "$CLI" --input "$file" --output "$OUTPUT_PATH/$name.png" --output "$OUTPUT_PATH/$name.h" --output "$OUTPUT_PATH/$name.rgi" > /dev/null || exit 1
+        "$CLI" --input "$OUTPUT_PATH/$name.png" --output "$OUTPUT_PATH/$name.png.rgi" > /dev/null || exit 1
+    done
+    i=$((i + 1))
+done
+
+echo "Training workload completed: $ITERATIONS iterations"
@@ -0,0 +1,212 @@
+/*******************************************************************************************
+*
+*   Worker Thread
+*
+*   MODULE USAGE:
+*       #define WORKER_THREAD_IMPLEMENTATION
+*       #include "worker_thread.h"
+*
+*   On background work:  StartWorkerThread(...), IsWorkerThreadFinished(...), JoinWorkerThread(...)
+*   On shutdown:         DetachWorkerThread(...), in case worker thread can not be waited for
+*
+*   NOTES:
+*     - One worker thread runs one function call, finished state can be polled without blocking
+*     - Worker thread must be joined or detached by the thread that started it
+*     - Detached worker thread keeps using its WorkerThread data, it must not be started again
+*     - Windows (MSVC) uses _beginthreadex(), other platforms use pthreads
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019-2025 raylib technologies (@raylibtech).
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef WORKER_THREAD_H
+#define WORKER_THREAD_H
+
+#include <stdbool.h>                        // Required for: bool
+
+#if !defined(_WIN32) || !defined(_MSC_VER)
+    #include <pthread.h>                    // Required for: pthread_t, pthread_mutex_t
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Worker function, called on worker thread with argument provided on start
+typedef void (*WorkerFunction)(void *arg);
+
+// Worker thread
+typedef struct WorkerThread {
+    bool running;                   // Worker thread started, not joined or detached yet (starting thread only)
+    WorkerFunction function;        // Worker function
+    void *arg;                      // Worker function argument
+#if defined(_WIN32) && defined(_MSC_VER)
+    void *handle;                   // Worker thread handle, signaled once finished
+#else
+    pthread_t handle;               // Worker thread
+    pthread_mutex_t mutex;          // Finished flag access
+    bool finished;                  // Worker function returned
+#endif
+} WorkerThread;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+bool StartWorkerThread(WorkerThread *worker, WorkerFunction function, void *arg); // Start worker thread, returns false if thread can not be created
+bool IsWorkerThreadFinished(WorkerThread *worker);  // Check if worker thread finished (non blocking), true if not running
+void JoinWorkerThread(WorkerThread *worker);        // Join worker thread (blocking), no effect if not running
+void DetachWorkerThread(WorkerThread *worker);      // Detach worker thread (non blocking), no effect if not running
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WORKER_THREAD_H
+
+
+/***********************************************************************************
+*
+*   WORKER_THREAD IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(WORKER_THREAD_IMPLEMENTATION)
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    #include <process.h>    // Required for: _beginthreadex()
+    // NOTE: Avoid including windows.h (conflicts with raylib), only two functions required
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+    __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+#if defined(_WIN32) && defined(_MSC_VER)
+static unsigned __stdcall WorkerThreadMain(void *arg);  // Worker thread entry point
+#else
+static void *WorkerThreadMain(void *arg);               // Worker thread entry point
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Start worker thread, function called with provided argument
+bool StartWorkerThread(WorkerThread *worker, WorkerFunction function, void *arg)
+{
+    if (worker->running) return false;
+
+    worker->function = function;
+    worker->arg = arg;
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    worker->handle = (void *)_beginthreadex(NULL, 0, WorkerThreadMain, worker, 0, NULL);
+    worker->running = (worker->handle != NULL);
+#else
+    worker->finished = false;
+
+    if (pthread_mutex_init(&worker->mutex, NULL) == 0)
+    {
+        worker->running = (pthread_create(&worker->handle, NULL, WorkerThreadMain, worker) == 0);
+        if (!worker->running) pthread_mutex_destroy(&worker->mutex);
+    }
+#endif
+
+    return worker->running;
+}
+
+// Check if worker thread finished (non blocking)
+bool IsWorkerThreadFinished(WorkerThread *worker)
+{
+    bool finished = true;
+
+    if (!worker->running) return finished;
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    finished = (WaitForSingleObject(worker->handle, 0) == 0);     // WAIT_OBJECT_0
+#else
+    pthread_mutex_lock(&worker->mutex);
+    finished = worker->finished;
+    pthread_mutex_unlock(&worker->mutex);
+#endif
+
+    return finished;
+}
+
+// Join worker thread (blocking)
+void JoinWorkerThread(WorkerThread *worker)
+{
+    if (!worker->running) return;
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    WaitForSingleObject(worker->handle, 0xFFFFFFFF);     // INFINITE
+    CloseHandle(worker->handle);
+#else
+    pthread_join(worker->handle, NULL);
+    pthread_mutex_destroy(&worker->mutex);
+#endif
+
+    worker->running = false;
+}
+
+// Detach worker thread (non blocking)
+// NOTE: Finished flag mutex is not destroyed, it is still used by worker thread once function returns
+void DetachWorkerThread(WorkerThread *worker)
+{
+    if (!worker->running) return;
+
+#if defined(_WIN32) && defined(_MSC_VER)
+    CloseHandle(worker->handle);
+#else
+    pthread_detach(worker->handle);
+#endif
+
+    worker->running = false;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Worker thread entry point, finished flag set once worker function returns
+#if defined(_WIN32) && defined(_MSC_VER)
+static unsigned __stdcall WorkerThreadMain(void *arg)
+#else
+static void *WorkerThreadMain(void *arg)
+#endif
+{
+    WorkerThread *worker = (WorkerThread *)arg;
+
+    worker->function(worker->arg);
+
+#if !defined(_WIN32) || !defined(_MSC_VER)
+    pthread_mutex_lock(&worker->mutex);
+    worker->finished = true;
+    pthread_mutex_unlock(&worker->mutex);
+#endif
+
+    return 0;
+}
+
+#endif // WORKER_THREAD_IMPLEMENTATION